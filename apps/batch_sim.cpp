@@ -0,0 +1,505 @@
+// Headless batch simulation. Loads a scene from a JSON file, runs it for a
+// number of steps without any GUI or GL dependency and streams per-step
+// results to an output directory.
+//
+// Example: ./bin/batch_sim ../scenes/beam_hang.json -n 200 -o ../output/beam
+//
+// Scene format (all fields except "mesh" are optional):
+// {
+//   "mesh": "../models/beam.mesh",  // .mesh files are simulated as
+//                                   // tetrahedral meshes, other formats as
+//                                   // 2D triangle meshes
+//   "normalize": true,              // scale by the largest coordinate
+//   "steps": 100,
+//   "output": "../output/beam",     // directory for the streamed results
+//   "frame_interval": 1,            // record vertices every n steps,
+//                                   // 0 never
+//   "frame_encoding": "double",     // "double", "float" or "quantized"
+//   "frame_quantum": 1e-5,          // grid spacing of quantized frames
+//   "keyframe_interval": 30,        // quantized frames between keyframes
+//   "checkpoint_interval": 0,       // write checkpoints every n steps,
+//                                   // 0 never
+//   "material": {"model": "Stable-Neohookean", "ym": 1e6, "pr": 0.45, ...},
+//   "sim": {"optimizer": "SQP-PD", "solver": "eigen-llt",
+//           "integrator": "BDF1", "bc": "hang",
+//           "system_precision": "double",
+//           "h": 0.034, "outer_steps": 5, ...}
+// }
+// The remaining "sim" and "material" fields are the SimConfig and
+// MaterialConfig members of the same name.
+//
+// The output directory receives stats.jsonl with one record per step,
+// the recorded frames in frames.bin (see frame_cache.h),
+// checkpoint_<step>.bin checkpoints and summary.json with the timings. A
+// run is resumed from a checkpoint with -r, e.g. after the job was
+// preempted:
+//   ./bin/batch_sim ../scenes/beam_hang.json -r ../output/beam_hang/checkpoint_00050.bin
+// The resumed run continues until the total number of steps is reached,
+// appends to the existing stats and records its frames to
+// frames_<step>.bin.
+
+#include <igl/readMESH.h>
+#include <igl/read_triangle_mesh.h>
+#include <igl/remove_unreferenced.h>
+#include <nlohmann/json.hpp>
+#include "args/args.hxx"
+
+#include "config.h"
+#include "checkpoint.h"
+#include "frame_cache.h"
+#include "boundary_conditions.h"
+#include "mesh/tet_mesh.h"
+#include "mesh/tri2d_mesh.h"
+#include "optimizers/optimizer.h"
+#include "energies/material_model.h"
+#include "factories/optimizer_factory.h"
+#include "factories/material_model_factory.h"
+#include "factories/solver_factory.h"
+#include "factories/integrator_factory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+using namespace Eigen;
+using namespace mfem;
+using json = nlohmann::json;
+
+namespace {
+
+  // Reads optional fields of a JSON object, remembering which were used
+  // so misspelled fields can be reported.
+  class FieldReader {
+  public:
+    FieldReader(const json& j, const std::string& section)
+        : j_(j), section_(section) {}
+
+    template <typename T>
+    void operator()(const std::string& key, T& value) {
+      used_.insert(key);
+      if (j_.contains(key)) {
+        value = j_.at(key).get<T>();
+      }
+    }
+
+    bool contains(const std::string& key) {
+      used_.insert(key);
+      return j_.contains(key);
+    }
+
+    std::string string(const std::string& key) {
+      used_.insert(key);
+      return j_.at(key).get<std::string>();
+    }
+
+    void warn_unused() const {
+      for (const auto& item : j_.items()) {
+        if (used_.count(item.key()) == 0) {
+          std::cerr << "Warning: unknown field '" << section_ << "."
+              << item.key() << "'" << std::endl;
+        }
+      }
+    }
+
+  private:
+    const json& j_;
+    std::string section_;
+    std::set<std::string> used_;
+  };
+
+  // Sets type to the value registered under the name in field key
+  template <typename Factory, typename TypeEnum>
+  bool read_type(FieldReader& read, const std::string& key, Factory& factory,
+      TypeEnum& type) {
+    if (!read.contains(key)) {
+      return true;
+    }
+    std::string name = read.string(key);
+    const std::vector<std::string>& names = factory.names();
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      std::cerr << "Unknown " << key << " '" << name << "', options are:";
+      for (const std::string& n : names) {
+        std::cerr << " '" << n << "'";
+      }
+      std::cerr << std::endl;
+      return false;
+    }
+    type = factory.type_by_name(name);
+    return true;
+  }
+
+  template <int DIM>
+  bool read_sim_config(const json& j, SimConfig& config) {
+    FieldReader read(j, "sim");
+
+    OptimizerFactory<DIM> optimizer_factory;
+    SolverFactory solver_factory;
+    IntegratorFactory integrator_factory;
+    if (!read_type(read, "optimizer", optimizer_factory, config.optimizer)
+        || !read_type(read, "solver", solver_factory, config.solver_type)
+        || !read_type(read, "integrator", integrator_factory,
+            config.ti_type)) {
+      return false;
+    }
+
+    if (read.contains("bc")) {
+      std::string name = read.string("bc");
+      std::vector<std::string> names;
+      BoundaryConditions<DIM>::get_script_names(names);
+      if (std::find(names.begin(), names.end(), name) == names.end()) {
+        std::cerr << "Unknown bc '" << name << "'" << std::endl;
+        return false;
+      }
+      config.bc_type = BoundaryConditions<DIM>::get_script_type(name);
+    }
+
+    if (read.contains("system_precision")) {
+      std::string name = read.string("system_precision");
+      if (name == "double") {
+        config.system_precision = SYSTEM_DOUBLE;
+      } else if (name == "mixed") {
+        config.system_precision = SYSTEM_MIXED;
+      } else if (name == "single") {
+        config.system_precision = SYSTEM_SINGLE;
+      } else {
+        std::cerr << "Unknown system precision '" << name << "'" << std::endl;
+        return false;
+      }
+    }
+
+    if (read.contains("ext")) {
+      std::vector<float> ext = j.at("ext").get<std::vector<float>>();
+      std::copy_n(ext.begin(), std::min<size_t>(ext.size(), 3), config.ext);
+    }
+
+    read("h", config.h);
+    config.h2 = config.h * config.h;
+    config.ih2 = 1.0 / config.h2;
+    read("outer_steps", config.outer_steps);
+    read("newton_tol", config.newton_tol);
+    read("ls_iters", config.ls_iters);
+    read("ls_speculative", config.ls_speculative);
+    read("max_iterative_solver_iters", config.max_iterative_solver_iters);
+    read("itr_tol", config.itr_tol);
+    read("symmetric_storage", config.symmetric_storage);
+    read("matrix_free", config.matrix_free);
+    read("block_storage", config.block_storage);
+    read("inexact_newton", config.inexact_newton);
+    read("inexact_eta_max", config.inexact_eta_max);
+    read("lagged_factorization", config.lagged_factorization);
+    read("lag_drift_tol", config.lag_drift_tol);
+    read("lag_max_iters", config.lag_max_iters);
+    read("warm_start", config.warm_start);
+    read("warm_start_multipliers", config.warm_start_multipliers);
+    read("adaptive_timestep", config.adaptive_timestep);
+    read("h_min", config.h_min);
+    read("h_max", config.h_max);
+    read("lte_tol", config.lte_tol);
+    read("kappa", config.kappa);
+    read("max_kappa", config.max_kappa);
+    read("constraint_tol", config.constraint_tol);
+    read("cache_dir", config.cache_dir);
+    read("show_data", config.show_data);
+    read("show_timing", config.show_timing);
+    read.warn_unused();
+    return true;
+  }
+
+  bool read_material_config(const json& j, MaterialConfig& config) {
+    FieldReader read(j, "material");
+
+    MaterialModelFactory material_factory;
+    if (!read_type(read, "model", material_factory, config.material_model)) {
+      return false;
+    }
+    read("ym", config.ym);
+    read("pr", config.pr);
+    read("density", config.density);
+    read("thickness", config.thickness);
+    Enu_to_lame(config.ym, config.pr, config.la, config.mu);
+    read.warn_unused();
+    return true;
+  }
+
+  template <int DIM>
+  std::shared_ptr<Mesh> create_mesh(const MatrixXd& V, const MatrixXi& T,
+      std::shared_ptr<MaterialModel> material,
+      std::shared_ptr<MaterialConfig> material_config) {
+    if constexpr (DIM == 3) {
+      return std::make_shared<TetrahedralMesh>(V, T, material,
+          material_config);
+    } else {
+      return std::make_shared<Tri2DMesh>(V, T, material, material_config);
+    }
+  }
+
+  // Newton iterations taken by the last step
+  template <int DIM>
+  int newton_iterations(const Optimizer<DIM>& optimizer) {
+    const OptimizerData& data = optimizer.data();
+    auto it = data.map_.find(" Iteration");
+    if (it != data.map_.end()) {
+      return it->second.size();
+    }
+    return data.energies_.size();
+  }
+
+  struct RunOptions {
+    int steps;
+    int frame_interval;
+    FrameCacheOptions frames;
+    int checkpoint_interval;
+    std::string output;
+    std::string restart;   // checkpoint to resume from
+  };
+
+  template <int DIM>
+  int run(const json& scene, const MatrixXd& V, const MatrixXi& T,
+      const RunOptions& options) {
+    using clock = std::chrono::high_resolution_clock;
+    auto setup_start = clock::now();
+
+    std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+    config->show_data = false;
+    config->show_timing = false;
+    std::shared_ptr<MaterialConfig> material_config =
+        std::make_shared<MaterialConfig>();
+    if (!read_sim_config<DIM>(scene.value("sim", json::object()), *config)
+        || !read_material_config(scene.value("material", json::object()),
+            *material_config)) {
+      return 1;
+    }
+
+    MaterialModelFactory material_factory;
+    std::shared_ptr<MaterialModel> material = material_factory.create(
+        material_config->material_model, material_config);
+    std::shared_ptr<Mesh> mesh = create_mesh<DIM>(V, T, material,
+        material_config);
+
+    OptimizerFactory<DIM> optimizer_factory;
+    std::shared_ptr<Optimizer<DIM>> optimizer = optimizer_factory.create(
+        config->optimizer, mesh, config);
+    optimizer->reset();
+
+    int start = 0;
+    double t = 0;
+    if (!options.restart.empty()) {
+      Checkpoint ckpt;
+      if (!read_checkpoint(options.restart, optimizer->checkpoint_key(), ckpt)
+          || !optimizer->load_state(ckpt)) {
+        std::cerr << "Failed to restore " << options.restart << std::endl;
+        return 1;
+      }
+      start = ckpt.step;
+      t = ckpt.time;
+    }
+    double setup_seconds = std::chrono::duration<double>(
+        clock::now() - setup_start).count();
+
+    std::ofstream stats;
+    if (!options.output.empty()) {
+      std::filesystem::create_directories(options.output);
+      stats.open(options.output + "/stats.jsonl", start > 0
+          ? std::ios::app : std::ios::out);
+    }
+
+    std::unique_ptr<FrameCacheWriter> frames;
+    if (stats.is_open() && options.frame_interval > 0) {
+      char buffer[32];
+      if (start > 0) {
+        sprintf(buffer, "/frames_%05d.bin", start);
+      } else {
+        sprintf(buffer, "/frames.bin");
+      }
+      frames = std::make_unique<FrameCacheWriter>(options.output + buffer,
+          mesh->V0_, T, options.frames);
+      if (start == 0) {
+        frames->write(0, 0, mesh->V_);
+      }
+    }
+
+    CheckpointWriter checkpoints;
+    int steps = std::max(options.steps - start, 0);
+    std::vector<double> step_ms(steps);
+    int total_iters = 0;
+    for (int i = start; i < options.steps; ++i) {
+      auto step_start = clock::now();
+      optimizer->step();
+      step_ms[i - start] = std::chrono::duration<double, std::milli>(
+          clock::now() - step_start).count();
+
+      int iters = newton_iterations(*optimizer);
+      total_iters += iters;
+      auto h = optimizer->data().map_.find("h");
+      t += h != optimizer->data().map_.end() ? h->second.back() : config->h;
+
+      json record = {{"step", i}, {"time", t}, {"ms", step_ms[i - start]},
+          {"iters", iters}};
+      auto dec = optimizer->data().map_.find("Newton dec");
+      if (dec != optimizer->data().map_.end()) {
+        record["decrement"] = dec->second.back();
+      }
+      std::cout << record.dump() << std::endl;
+
+      if (stats.is_open()) {
+        stats << record.dump() << std::endl;
+        if (frames && (i + 1) % options.frame_interval == 0) {
+          frames->write(i + 1, t, mesh->V_);
+        }
+        if (options.checkpoint_interval > 0
+            && (i + 1) % options.checkpoint_interval == 0) {
+          Checkpoint ckpt;
+          ckpt.step = i + 1;
+          ckpt.time = t;
+          optimizer->save_state(ckpt);
+          char buffer[32];
+          sprintf(buffer, "/checkpoint_%05d.bin", i + 1);
+          checkpoints.write(options.output + buffer, std::move(ckpt));
+        }
+      }
+    }
+    checkpoints.wait();
+    if (frames && !frames->close()) {
+      std::cerr << "Failed to write frames" << std::endl;
+    }
+
+    // Timing summary
+    double total_ms = 0;
+    for (double ms : step_ms) {
+      total_ms += ms;
+    }
+    std::vector<double> sorted = step_ms;
+    std::sort(sorted.begin(), sorted.end());
+    int denom = std::max(steps, 1);
+    json summary = {
+      {"elements", T.rows()},
+      {"vertices", V.rows()},
+      {"steps", steps},
+      {"simulated_time", t},
+      {"setup_s", setup_seconds},
+      {"total_s", total_ms / 1e3},
+      {"ms_per_step", total_ms / denom},
+      {"median_ms", sorted.empty() ? 0 : sorted[sorted.size() / 2]},
+      {"max_ms", sorted.empty() ? 0 : sorted.back()},
+      {"iters_per_step", double(total_iters) / denom}
+    };
+
+    printf("%d elements, %d steps (%.3f s simulated)\n", int(T.rows()),
+        steps, t);
+    printf("  setup        %10.3f s\n", setup_seconds);
+    printf("  total        %10.3f s\n", total_ms / 1e3);
+    printf("  ms/step      %10.3f (median %.3f, max %.3f)\n",
+        total_ms / denom, summary["median_ms"].get<double>(),
+        summary["max_ms"].get<double>());
+    printf("  iters/step   %10.2f\n", double(total_iters) / denom);
+
+    if (!options.output.empty()) {
+      std::ofstream(options.output + "/summary.json") << summary.dump(2)
+          << std::endl;
+    }
+    return 0;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  args::ArgumentParser parser("Mixed FEM headless batch simulation");
+  args::Positional<std::string> scene_arg(parser, "<scene>.json",
+      "scene file");
+  args::ValueFlag<int> steps_arg(parser, "integer",
+      "number of timesteps (overrides the scene)", {'n'});
+  args::ValueFlag<std::string> output_arg(parser, "dir",
+      "output directory (overrides the scene)", {'o'});
+  args::ValueFlag<std::string> restart_arg(parser, "checkpoint.bin",
+      "resume from a checkpoint", {'r'});
+
+  try {
+    parser.ParseCLI(argc, argv);
+  } catch (args::Help) {
+    std::cout << parser;
+    return 0;
+  } catch (args::ParseError e) {
+    std::cerr << e.what() << std::endl;
+    std::cerr << parser;
+    return 1;
+  }
+
+  if (!scene_arg) {
+    std::cerr << parser;
+    return 1;
+  }
+
+  json scene;
+  try {
+    std::ifstream file(args::get(scene_arg));
+    if (!file) {
+      std::cerr << "Failed to open " << args::get(scene_arg) << std::endl;
+      return 1;
+    }
+    scene = json::parse(file, nullptr, true, true);
+
+    RunOptions options;
+    options.steps = steps_arg ? args::get(steps_arg)
+                              : scene.value("steps", 100);
+    options.output = output_arg ? args::get(output_arg)
+                                : scene.value("output", std::string());
+    options.frame_interval = scene.value("frame_interval", 1);
+    std::string encoding = scene.value("frame_encoding", "double");
+    if (encoding == "double") {
+      options.frames.encoding = FRAME_DOUBLE;
+    } else if (encoding == "float") {
+      options.frames.encoding = FRAME_FLOAT;
+    } else if (encoding == "quantized") {
+      options.frames.encoding = FRAME_QUANTIZED;
+    } else {
+      std::cerr << "Unknown frame_encoding '" << encoding << "'"
+          << std::endl;
+      return 1;
+    }
+    options.frames.quantum = scene.value("frame_quantum",
+        options.frames.quantum);
+    options.frames.keyframe_interval = scene.value("keyframe_interval",
+        options.frames.keyframe_interval);
+    options.checkpoint_interval = scene.value("checkpoint_interval", 0);
+    options.restart = restart_arg ? args::get(restart_arg) : std::string();
+
+    // Mesh paths are relative to the scene file
+    std::filesystem::path mesh_path = scene.at("mesh").get<std::string>();
+    if (mesh_path.is_relative()) {
+      mesh_path = std::filesystem::path(args::get(scene_arg)).parent_path()
+          / mesh_path;
+    }
+
+    MatrixXd V;
+    MatrixXi T, F;
+    bool tets = mesh_path.extension() == ".mesh";
+    if (tets) {
+      if (!igl::readMESH(mesh_path.string(), V, T, F)) {
+        std::cerr << "Failed to read " << mesh_path << std::endl;
+        return 1;
+      }
+    } else {
+      MatrixXd V3;
+      MatrixXi F3;
+      VectorXi I, J;
+      if (!igl::read_triangle_mesh(mesh_path.string(), V3, F3)) {
+        std::cerr << "Failed to read " << mesh_path << std::endl;
+        return 1;
+      }
+      igl::remove_unreferenced(V3, F3, V, T, I, J);
+      V.conservativeResize(V.rows(), 2);
+    }
+    if (scene.value("normalize", true)) {
+      V.array() /= V.maxCoeff();
+    }
+
+    return tets ? run<3>(scene, V, T, options) : run<2>(scene, V, T, options);
+  } catch (const json::exception& e) {
+    std::cerr << "Invalid scene: " << e.what() << std::endl;
+    return 1;
+  }
+}
@@ -1,60 +1,110 @@
-#include "polyscope/polyscope.h"
+// Computes the elastic and kinetic energy of every frame of a recorded
+// simulation. Frames are streamed from the memory-mapped frame cache, so
+// trajectories longer than memory can be processed. Writes one JSON object
+// per frame.
+//
+// Example: ./bin/energy ../output/frames.bin --ym 1e5
+//     --model Stable-Neohookean -o ../output/energy.jsonl
 
-// libigl
-#include <igl/boundary_facets.h>
-#include <igl/IO>
-
-// Polyscope
 #include "args/args.hxx"
-#include "json/json.hpp"
+#include <nlohmann/json.hpp>
 
-#include "mesh/mesh.h"
+#include "frame_cache.h"
+#include "mesh/tet_mesh.h"
+#include "mesh/tri2d_mesh.h"
 #include "energies/material_model.h"
-#include "energies/stable_neohookean.h"
-
-#include "optimizers/mixed_alm_optimizer.h"
-#include "optimizers/mixed_admm_optimizer.h"
-#include "optimizers/mixed_sqp_optimizer.h"
-#include "optimizers/mixed_sqp_pd_optimizer.h"
-#include "optimizers/newton_optimizer.h"
-#include "boundary_conditions.h"
-#include <sstream>
+#include "factories/material_model_factory.h"
+
+#include <algorithm>
 #include <fstream>
 #include <iostream>
-#include <filesystem>
-namespace fs = std::filesystem;
-
 
 using namespace Eigen;
-
-// The mesh, Eigen representation
-MatrixXd meshV, meshV0;
-MatrixXi meshF;
-MatrixXi meshT;
-
 using namespace mfem;
-std::shared_ptr<SimConfig> config;
-std::shared_ptr<MaterialModel> material;
-std::shared_ptr<MaterialConfig> material_config;
-std::shared_ptr<Mesh> tet_object;
-std::shared_ptr<NewtonOptimizer> optimizer;
+using json = nlohmann::json;
+
+namespace {
+
+  // Elastic energy of the vertex positions x (DIM * #V)
+  template <int DIM>
+  double elastic_energy(const Mesh& mesh, MaterialModel& material,
+      const VectorXd& vols, const VectorXd& x) {
+    double e = 0;
+    #pragma omp parallel for reduction(+ : e)
+    for (int i = 0; i < vols.size(); ++i) {
+      e += vols(i) * material.energy(
+          mesh.element_deformation_gradient<DIM>(i, x));
+    }
+    return e;
+  }
 
-std::vector<std::string> bc_list;
+  template <int DIM>
+  int run(FrameCacheReader& reader, std::shared_ptr<MaterialConfig> config,
+      std::ostream& out) {
+    MaterialModelFactory material_factory;
+    std::shared_ptr<MaterialModel> material = material_factory.create(
+        config->material_model, config);
+
+    std::shared_ptr<Mesh> mesh;
+    if constexpr (DIM == 3) {
+      mesh = std::make_shared<TetrahedralMesh>(reader.rest_positions(),
+          reader.elements(), material, config);
+    } else {
+      mesh = std::make_shared<Tri2DMesh>(reader.rest_positions(),
+          reader.elements(), material, config);
+    }
+    mesh->init();
+
+    const VectorXd& vols = mesh->volumes();
+    SparseMatrixdRowMajor M;
+    mesh->mass_matrix(M, vols);
+
+    // Velocities are finite differences of consecutive frames
+    Frame frame;
+    VectorXd x, x_prev;
+    double t_prev = 0;
+    while (reader.next(frame)) {
+      MatrixXd Vt = frame.V.transpose();
+      x = Map<VectorXd>(Vt.data(), Vt.size());
+
+      double kinetic = 0;
+      if (x_prev.size() == x.size() && frame.time > t_prev) {
+        VectorXd v = (x - x_prev) / (frame.time - t_prev);
+        kinetic = 0.5 * v.dot(M * v);
+      }
+      double elastic = elastic_energy<DIM>(*mesh, *material, vols, x);
+
+      json record;
+      record["step"] = frame.step;
+      record["time"] = frame.time;
+      record["elastic"] = elastic;
+      record["kinetic"] = kinetic;
+      record["total"] = elastic + kinetic;
+      out << record.dump() << std::endl;
+
+      x_prev.swap(x);
+      t_prev = frame.time;
+    }
+    return 0;
+  }
 
-void simulation_step() {
-  optimizer->step();
-  meshV = tet_object->vertices();
 }
 
-// ./bin/energy -p /media/ty/ECB0AB91B0AB60B6/blendering/Gecko_1e8/fem_data -n 100 -r ../models/gecko.mesh
 int main(int argc, char **argv) {
-  // Configure the argument parser
-  args::ArgumentParser parser("Mixed FEM", "Example: ./bin/energy -r ../models/coarse_bunny.mesh  \
-      --path ../output/ -n 100 -ym 1e5");
-  args::ValueFlag<std::string> rest_arg(parser, "<file_name>.mesh", "Rest state mesh", {'r', "rest"});
-  args::ValueFlag<std::string> path_arg(parser, "/path/to/ <sim_x0_step> files", "Path to x0 and v data", {'p', "path"});
-  args::ValueFlag<int> n_arg(parser, "integer", "number of steps", {'n'});
-  args::ValueFlag<double> ym_arg(parser,"double", "Youngs modulus", {"ym"});
+  args::ArgumentParser parser("Energies of a recorded simulation",
+      "Example: ./bin/energy ../output/frames.bin --ym 1e5");
+  args::Positional<std::string> frames_arg(parser, "frames.bin",
+      "recorded frames");
+  args::ValueFlag<std::string> model_arg(parser, "name", "material model",
+      {"model"});
+  args::ValueFlag<double> ym_arg(parser, "double", "Young's modulus",
+      {"ym"});
+  args::ValueFlag<double> pr_arg(parser, "double", "Poisson's ratio",
+      {"pr"});
+  args::ValueFlag<double> density_arg(parser, "double", "density",
+      {"density"});
+  args::ValueFlag<std::string> output_arg(parser, "file",
+      "output file (default: stdout)", {'o', "output"});
 
   // Parse args
   try {
@@ -67,78 +117,53 @@ int main(int argc, char **argv) {
     std::cerr << parser;
     return 1;
   }
-  std::string rest_fn = args::get(rest_arg);
-  std::string path_fn = args::get(path_arg);
-  double ym = args::get(ym_arg);
-  int n = args::get(n_arg);
-  std::cout << "Path: " << path_fn << std::endl;
-  std::cout << "n: " << n << std::endl;
-  std::cout << "YM: " << ym << std::endl;
-  fs::path dir(path_fn);
-
-    // Read the mesh
-  igl::readMESH(rest_fn, meshV, meshT, meshF);
-  double fac = meshV.maxCoeff();
-  meshV.array() /= fac;
-
-  if (meshF.size() == 0){ 
-    igl::boundary_facets(meshT, meshF);
+
+  if (!frames_arg) {
+    std::cerr << parser;
+    return 1;
+  }
+
+  std::shared_ptr<MaterialConfig> config = std::make_shared<MaterialConfig>();
+  if (model_arg) {
+    MaterialModelFactory material_factory;
+    const std::vector<std::string>& names = material_factory.names();
+    std::string name = args::get(model_arg);
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      std::cerr << "Unknown material model " << name << std::endl;
+      return 1;
+    }
+    config->material_model = material_factory.type_by_name(name);
+  }
+  if (ym_arg) {
+    config->ym = args::get(ym_arg);
   }
-  std::cout << "V : " << meshV.rows() << " T: " << meshT.rows() << std::endl;
-
-  // Initial simulation setup
-  config = std::make_shared<SimConfig>();
-  config->bc_type = BC_NULL;
-
-  material_config = std::make_shared<MaterialConfig>();
-  Enu_to_lame(ym, material_config->pr,
-      material_config->la, material_config->mu);
-  material = std::make_shared<StableNeohookean>(material_config);
-  tet_object = std::make_shared<TetrahedralMesh>(meshV, meshT,
-      material, material_config);
-  optimizer = std::make_shared<NewtonOptimizer>(tet_object,config);
-  optimizer->reset();
-
-
-  for (int i = 1; i <= n; ++i) {
-    char buffer[50];
-    int n = sprintf(buffer, "sim_v_%04d.dmat", i); 
-    buffer[n] = 0;
-    std::string v_fn(buffer);
-
-    n = sprintf(buffer, "sim_x0_%04d.dmat", i); 
-    buffer[n] = 0;
-    std::string x_fn(buffer);
-    //     fs::path dir ("/tmp");
-    fs::path v_file(v_fn);
-    fs::path x_file(x_fn);
-    fs::path x_full_path = dir / x_file;
-    fs::path v_full_path = dir / v_file;
-
-    // std::cout << "x_full_path" << x_full_path << std::endl;
-
-    VectorXd v;
-    igl::readDMAT(std::string(x_full_path), v);
-    // std::cout << x_full_path << std::endl;
-    double KE = v.transpose() * optimizer->M_ * v;
-    std::cout << KE << std::endl;
+  if (pr_arg) {
+    config->pr = args::get(pr_arg);
   }
+  if (density_arg) {
+    config->density = args::get(density_arg);
+  }
+  Enu_to_lame(config->ym, config->pr, config->la, config->mu);
 
-  // optimizer->x0_ = x0;
-  // optimizer->vt_ = v;
-  // int nsteps = x.cols();
-  // for (int i = 0; i < nsteps; ++i) {
-  //   optimizer->x_ = optimizer->P_ * x.col(i);
-  //   optimizer->b_ = x.col(i) - optimizer->P_ .transpose()*optimizer->P_*x.col(i);
-  //   optimizer->build_lhs();
-  //   optimizer->build_rhs();
-
-  //   // Compute search direction
-  //   double decrement;
-  //   optimizer->substep(i, decrement);
-  //   std::cout << decrement << std::endl;
-  // }
-
-  return 0;
-}
+  std::string path = args::get(frames_arg);
+  FrameCacheReader reader(path);
+  if (!reader.good()) {
+    std::cerr << "Failed to read frames " << path << std::endl;
+    return 1;
+  }
+
+  std::ofstream file;
+  if (output_arg) {
+    file.open(args::get(output_arg));
+  }
+  std::ostream& out = file.is_open() ? file : std::cout;
 
+  if (reader.dim() == 3 && reader.elements().cols() == 4) {
+    return run<3>(reader, config, out);
+  } else if (reader.dim() == 2 && reader.elements().cols() == 3) {
+    return run<2>(reader, config, out);
+  }
+  std::cerr << "Only tetrahedral and 2D triangle meshes are supported"
+            << std::endl;
+  return 1;
+}
@@ -0,0 +1,449 @@
+// Microbenchmarks of the per-element and assembly kernels. Each kernel is
+// timed on the deformation gradients and sparsity of every input mesh: the
+// given tetrahedral meshes and synthetic cubes refined to n^3 cells. Results
+// are printed and written to a JSON file so runs of different versions can
+// be compared.
+//
+// Per-element kernels run single-threaded, so their times are per-element
+// costs. The assembly kernels and pcg use as many threads as the
+// simulator does.
+//
+// Example: ./bin/kernel_benchmark ../models/coarse_bunny.mesh --cube 8
+//     --cube 16 -o kernels.json
+
+#include <igl/readMESH.h>
+#include <nlohmann/json.hpp>
+#include "args/args.hxx"
+
+#include "batch_matrix.h"
+#include "sparse_utils.h"
+#include "mesh/tet_mesh.h"
+#include "svd/batch_polar.h"
+#include "svd/dsvd.h"
+#include "svd/newton_procrustes.h"
+#include "linear_solvers/pcg.h"
+#include "energies/material_model.h"
+#include "factories/material_model_factory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+#if defined(SIM_USE_OPENMP)
+#include <omp.h>
+#endif
+
+using namespace Eigen;
+using namespace mfem;
+using json = nlohmann::json;
+
+namespace {
+
+  struct BenchmarkOptions {
+    double min_time;     // seconds spent repeating each kernel
+    std::string filter;  // only run kernels whose name contains this
+  };
+
+  // Keeps results of the timed kernels alive
+  volatile double sink;
+
+  // Times f, repeating it until min_time has passed. One untimed call
+  // warms up caches and lazily built state.
+  // items - elements (or rows) processed by one call of f
+  template <typename Func>
+  json measure(const std::string& name, const std::string& input, int items,
+      const BenchmarkOptions& options, Func&& f) {
+    using clock = std::chrono::high_resolution_clock;
+    f();
+
+    std::vector<double> ms;
+    double total = 0;
+    while ((total < 1e3 * options.min_time || ms.size() < 3)
+        && ms.size() < 10000) {
+      auto start = clock::now();
+      f();
+      double t = std::chrono::duration<double, std::milli>(
+          clock::now() - start).count();
+      ms.push_back(t);
+      total += t;
+    }
+    std::sort(ms.begin(), ms.end());
+    double median = ms[ms.size() / 2];
+
+    printf("  %-36s %10.4f ms %10.1f ns/item %8zu reps\n", name.c_str(),
+        median, 1e6 * median / items, ms.size());
+
+    json result;
+    result["name"] = name;
+    result["input"] = input;
+    result["items"] = items;
+    result["repeats"] = ms.size();
+    result["min_ms"] = ms.front();
+    result["median_ms"] = median;
+    result["mean_ms"] = total / ms.size();
+    result["ns_per_item"] = 1e6 * median / items;
+    return result;
+  }
+
+  // Unit cube split into n^3 cells of 6 tetrahedra each
+  void refined_cube(int n, MatrixXd& V, MatrixXi& T) {
+    auto id = [n](int i, int j, int k) {
+      return (i * (n+1) + j) * (n+1) + k;
+    };
+    V.resize((n+1) * (n+1) * (n+1), 3);
+    for (int i = 0; i <= n; ++i) {
+      for (int j = 0; j <= n; ++j) {
+        for (int k = 0; k <= n; ++k) {
+          V.row(id(i,j,k)) = RowVector3d(i, j, k) / n;
+        }
+      }
+    }
+
+    // Each tetrahedron walks from the cell's lower to its upper corner
+    // along the axes in one of the 6 orders
+    int orders[6][3] = {{0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1},
+        {2,1,0}};
+    T.resize(6 * n * n * n, 4);
+    int e = 0;
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        for (int k = 0; k < n; ++k) {
+          for (const auto& order : orders) {
+            int c[3] = {i, j, k};
+            T(e,0) = id(c[0], c[1], c[2]);
+            for (int a = 0; a < 3; ++a) {
+              ++c[order[a]];
+              T(e,a+1) = id(c[0], c[1], c[2]);
+            }
+
+            // Positive orientation
+            Matrix3d D;
+            for (int a = 0; a < 3; ++a) {
+              D.col(a) = (V.row(T(e,a+1)) - V.row(T(e,0))).transpose();
+            }
+            if (D.determinant() < 0) {
+              std::swap(T(e,1), T(e,2));
+            }
+            ++e;
+          }
+        }
+      }
+    }
+  }
+
+  void run(const std::string& input, const MatrixXd& V, const MatrixXi& T,
+      const BenchmarkOptions& options, json& results) {
+    auto enabled = [&](const std::string& name) {
+      return name.find(options.filter) != std::string::npos;
+    };
+    auto add = [&](const std::string& name, int items, auto&& f) {
+      if (enabled(name)) {
+        results.push_back(measure(name, input, items, options, f));
+      }
+    };
+
+    std::shared_ptr<MaterialConfig> material_config =
+        std::make_shared<MaterialConfig>();
+    MaterialModelFactory material_factory;
+    std::shared_ptr<MaterialModel> material = material_factory.create(
+        material_config->material_model, material_config);
+    std::shared_ptr<Mesh> mesh = std::make_shared<TetrahedralMesh>(V, T,
+        material, material_config);
+    mesh->init();
+
+    int nelem = T.rows();
+    int nbatch = (nelem + BATCH_WIDTH - 1) / BATCH_WIDTH;
+    std::cout << input << ": " << V.rows() << " vertices, " << nelem
+        << " elements" << std::endl;
+
+    // A smooth deformation without inverted elements
+    MatrixXd Vx = V + 0.1 * V.array().sin().matrix();
+    MatrixXd Vt = Vx.transpose();
+    VectorXd x = Map<VectorXd>(Vt.data(), Vt.size());
+    std::vector<Matrix3d> F(nelem);
+    for (int i = 0; i < nelem; ++i) {
+      Vector9d f = mesh->element_deformation_gradient<3>(i, x);
+      F[i] = Map<Matrix3d>(f.data());
+    }
+    BatchMatrix<double,3,3> Fb, Rb;
+    BatchMatrix<double,2,2> F2b, R2b;
+    Fb.resize(nelem);
+    F2b.resize(nelem);
+    Fb.fill(Matrix3d::Identity());
+    F2b.fill(Matrix2d::Identity());
+    for (int i = 0; i < nelem; ++i) {
+      Fb.set(i, F[i]);
+      F2b.set(i, F[i].topLeftCorner<2,2>());
+    }
+    Rb.resize(nelem);
+    R2b.resize(nelem);
+
+    // Rotations are found from scratch, starting at the identity
+    LaneMatrix<double,3,3> I;
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      I.set(l, Matrix3d::Identity());
+    }
+
+    // Polar decompositions
+    std::vector<Matrix3d> R(nelem);
+    add("newton_procrustes", nelem, [&]() {
+      for (int i = 0; i < nelem; ++i) {
+        R[i].setIdentity();
+        newton_procrustes(R[i], Matrix3d::Identity(), F[i]);
+      }
+      sink = R[0](0,0);
+    });
+
+    std::vector<LaneMatrix<double,6,1>> Sb(nbatch);
+    std::vector<LaneMatrix<double,6,9>> dsdF(nbatch);
+    add("batch_polar_3d", nelem, [&]() {
+      for (int b = 0; b < nbatch; ++b) {
+        Rb.batch(b) = I;
+        batch_polar(Fb.batch(b), Rb.batch(b), Sb[b], &dsdF[b]);
+      }
+      sink = Sb[0].v[0][0];
+    });
+
+    std::vector<LaneMatrix<double,3,1>> S2b(nbatch);
+    std::vector<LaneMatrix<double,3,4>> dsdF2(nbatch);
+    add("batch_polar_2d", nelem, [&]() {
+      for (int b = 0; b < nbatch; ++b) {
+        batch_polar(F2b.batch(b), R2b.batch(b), S2b[b], &dsdF2[b]);
+      }
+      sink = S2b[0].v[0][0];
+    });
+
+    add("dsvd_3d", nelem, [&]() {
+      Tensor3333d dU, dV;
+      Tensor333d dS;
+      for (int i = 0; i < nelem; ++i) {
+        dsvd(dU, dS, dV, F[i]);
+      }
+      sink = dS[0][0](0);
+    });
+
+    add("dsvd_2d", nelem, [&]() {
+      Tensor2222d dU, dV;
+      Tensor222d dS;
+      for (int i = 0; i < nelem; ++i) {
+        dsvd(dU, dS, dV, F[i].topLeftCorner<2,2>());
+      }
+      sink = dS[0][0](0);
+    });
+
+    // Material models, evaluated on the stretches of the deformation
+    for (int b = 0; b < nbatch; ++b) {
+      Rb.batch(b) = I;
+      batch_polar(Fb.batch(b), Rb.batch(b), Sb[b]);
+    }
+    std::vector<Vector6d> S(nelem);
+    for (int i = 0; i < nelem; ++i) {
+      S[i] = Sb[i / BATCH_WIDTH].get(i % BATCH_WIDTH);
+    }
+
+    for (const std::string& model : material_factory.names()) {
+      std::shared_ptr<MaterialModel> m = material_factory.create(
+          material_factory.type_by_name(model), material_config);
+      std::vector<Vector6d> g(nelem);
+      std::vector<Matrix6d> H(nelem);
+      std::vector<LaneMatrix<double,6,1>> gb(nbatch);
+      std::vector<LaneMatrix<double,6,6>> Hb(nbatch);
+
+      add(model + "/gradient", nelem, [&]() {
+        for (int i = 0; i < nelem; ++i) {
+          g[i] = m->gradient(S[i]);
+        }
+        sink = g[0](0);
+      });
+      add(model + "/hessian", nelem, [&]() {
+        for (int i = 0; i < nelem; ++i) {
+          H[i] = m->hessian(S[i]);
+        }
+        sink = H[0](0,0);
+      });
+      add(model + "/gradient_batch", nelem, [&]() {
+        for (int b = 0; b < nbatch; ++b) {
+          m->gradient(Sb[b], gb[b]);
+        }
+        sink = gb[0].v[0][0];
+      });
+      add(model + "/hessian_batch", nelem, [&]() {
+        for (int b = 0; b < nbatch; ++b) {
+          m->hessian(Sb[b], Hb[b]);
+        }
+        sink = Hb[0].v[0][0];
+      });
+    }
+
+    // Assembly
+    std::vector<int> free_map(V.rows());
+    std::iota(free_map.begin(), free_map.end(), 0);
+
+    std::vector<Matrix<double,12,12>> blocks(nelem);
+    for (int i = 0; i < nelem; ++i) {
+      Matrix<double,12,12> B = Matrix<double,12,12>::Random();
+      blocks[i] = B * B.transpose();
+    }
+    if (enabled("assembler_update_matrix")) {
+      Assembler<double,3,4> assembler(T, free_map);
+      add("assembler_update_matrix", nelem, [&]() {
+        assembler.update_matrix(blocks);
+        sink = assembler.A.valuePtr()[0];
+      });
+      Assembler<double,3,4> upper(T, free_map, true);
+      add("assembler_update_matrix_upper", nelem, [&]() {
+        upper.update_matrix(blocks);
+        sink = upper.A.valuePtr()[0];
+      });
+    }
+
+    std::vector<Matrix<double,12,1>> vecs(nelem);
+    for (int i = 0; i < nelem; ++i) {
+      vecs[i].setRandom();
+    }
+    if (enabled("vec_assembler_assemble")) {
+      VectorXd a;
+      VecAssembler<double,3,4> gather(T, free_map);
+      add("vec_assembler_assemble", nelem, [&]() {
+        gather.assemble(vecs, a);
+        sink = a(0);
+      });
+      VecAssembler<double,3,4> colored(T, free_map, true);
+      add("vec_assembler_assemble_colored", nelem, [&]() {
+        colored.assemble(vecs, a);
+        sink = a(0);
+      });
+    }
+
+    // KKT matrix [M J; J^T C] of the mass matrix, the deformation gradient
+    // jacobian and per-element 9x9 blocks
+    const SparseMatrixdRowMajor& M = mesh->mass_matrix();
+    SparseMatrix<double, RowMajor> JT = mesh->jacobian().transpose();
+    JT.makeCompressed();
+    std::vector<Matrix9d> C(nelem);
+    for (int i = 0; i < nelem; ++i) {
+      C[i] = Matrix9d::Identity();
+    }
+    SparseMatrix<double, RowMajor> P;
+    add("fill_block_matrix", nelem, [&]() {
+      fill_block_matrix(M, JT, C, P);
+      sink = P.valuePtr()[0];
+    });
+    if (enabled("block_matrix_assembler_update")) {
+      BlockMatrixAssembler<9, RowMajor, RowMajor, RowMajor> kkt(M, JT, C, P);
+      add("block_matrix_assembler_update", nelem, [&]() {
+        kkt.update(M, JT, C, P);
+        sink = P.valuePtr()[0];
+      });
+    }
+
+    // Implicit Euler style system M + h^2 K with K a vector laplacian
+    if (enabled("pcg")) {
+      double h = 0.034;
+      SparseMatrixdRowMajor A = M + h * h * material_config->mu
+          * mesh->laplacian();
+      VectorXd b = M * VectorXd::Ones(A.rows());
+      VectorXd y, r, z, zm1, p, Ap;
+      DiagonalPreconditioner<double> pre(A);
+      int iters = 0;
+      json result = measure("pcg", input, A.rows(), options, [&]() {
+        y = VectorXd::Zero(A.rows());
+        iters = pcg(y, A, b, r, z, zm1, p, Ap, pre, 1e-8, 10000);
+        sink = y(0);
+      });
+      result["iterations"] = iters;
+      results.push_back(result);
+    }
+  }
+
+}
+
+int main(int argc, char **argv) {
+  args::ArgumentParser parser("Mixed FEM kernel benchmarks");
+  args::PositionalList<std::string> files_arg(parser, "<file>.mesh",
+      "tetrahedral meshes");
+  args::ValueFlagList<int> cube_arg(parser, "n",
+      "unit cube refined to n^3 cells", {"cube"});
+  args::ValueFlag<double> time_arg(parser, "seconds",
+      "minimum time spent on each kernel", {"min-time"});
+  args::ValueFlag<std::string> filter_arg(parser, "name",
+      "only run kernels whose name contains this", {"filter"});
+  args::ValueFlag<std::string> output_arg(parser, "file",
+      "JSON output (default: kernel_benchmark.json)", {'o', "output"});
+
+  try {
+    parser.ParseCLI(argc, argv);
+  } catch (args::Help) {
+    std::cout << parser;
+    return 0;
+  } catch (args::ParseError e) {
+    std::cerr << e.what() << std::endl;
+    std::cerr << parser;
+    return 1;
+  }
+
+  std::vector<std::string> files = args::get(files_arg);
+  std::vector<int> cubes = args::get(cube_arg);
+  if (files.empty() && cubes.empty()) {
+    files = {"../models/coarse_bunny.mesh", "../models/beam.mesh"};
+    cubes = {8, 16};
+  }
+
+  BenchmarkOptions options;
+  options.min_time = time_arg ? args::get(time_arg) : 0.2;
+  options.filter = filter_arg ? args::get(filter_arg) : "";
+  std::string output = output_arg ? args::get(output_arg)
+                                  : "kernel_benchmark.json";
+
+  json results = json::array();
+  for (const std::string& file : files) {
+    MatrixXd V;
+    MatrixXi T, F;
+    if (!igl::readMESH(file, V, T, F)) {
+      std::cerr << "Failed to read " << file << std::endl;
+      continue;
+    }
+    V.array() /= V.maxCoeff();
+    run(file, V, T, options, results);
+  }
+  for (int n : cubes) {
+    MatrixXd V;
+    MatrixXi T;
+    refined_cube(n, V, T);
+    run("cube_" + std::to_string(n), V, T, options, results);
+  }
+
+  char date[32];
+  std::time_t now = std::time(nullptr);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S",
+      std::localtime(&now));
+
+  json context;
+  context["date"] = date;
+  context["batch_width"] = BATCH_WIDTH;
+  #if defined(SIM_USE_OPENMP)
+  context["threads"] = omp_get_max_threads();
+  #else
+  context["threads"] = 1;
+  #endif
+  context["eigen"] = std::to_string(EIGEN_WORLD_VERSION) + "."
+      + std::to_string(EIGEN_MAJOR_VERSION) + "."
+      + std::to_string(EIGEN_MINOR_VERSION);
+  context["min_time"] = options.min_time;
+
+  json out;
+  out["context"] = context;
+  out["benchmarks"] = results;
+  std::ofstream file(output);
+  file << out.dump(2) << std::endl;
+  if (!file) {
+    std::cerr << "Failed to write " << output << std::endl;
+    return 1;
+  }
+  std::cout << "Wrote " << output << std::endl;
+  return 0;
+}
@@ -12,6 +12,7 @@
 #include "json/json.hpp"
 
 #include "mesh/mesh.h"
+#include "frame_cache.h"
 #include "optimizers/optimizer.h"
 #include "energies/material_model.h"
 
@@ -71,24 +72,111 @@ namespace mfem {
       meshV = mesh->vertices();
     }
 
+    // Opens a recorded simulation for playback. The callback then scrubs
+    // through its frames instead of simulating.
+    bool load_playback(const std::string& path) {
+      auto reader = std::make_shared<FrameCacheReader>(path);
+      if (!reader->good() || reader->vertices() != meshV.rows()
+          || reader->dim() != meshV.cols()) {
+        std::cerr << "Frames " << path << " don't match the mesh"
+                  << std::endl;
+        return false;
+      }
+      playback = reader;
+      playback_frame = 0;
+      show_frame(playback_frame);
+      return true;
+    }
+
+    void show_frame(int i) {
+      Frame frame;
+      if (!playback->read(i, frame)) {
+        return;
+      }
+      meshV = frame.V;
+      if (DIM == 3) {
+        srf->updateVertexPositions(meshV);
+      } else {
+        srf->updateVertexPositions2D(meshV);
+      }
+    }
+
+    void playback_callback() {
+      static bool playing = false;
+
+      // Picks up frames recorded since the file was opened
+      if (ImGui::Button("reload")) {
+        playback->refresh();
+      }
+
+      int frames = playback->frames();
+      if (frames == 0) {
+        ImGui::SameLine();
+        ImGui::Text("No frames recorded yet");
+        return;
+      }
+      playback_frame = std::max(0, std::min(playback_frame, frames - 1));
+
+      ImGui::PushItemWidth(300);
+      if (ImGui::SliderInt("Frame", &playback_frame, 0, frames - 1)) {
+        playback_frame = std::max(0, std::min(playback_frame, frames - 1));
+        show_frame(playback_frame);
+      }
+      ImGui::PopItemWidth();
+
+      if (ImGui::Button("<")) {
+        playback_frame = std::max(0, playback_frame - 1);
+        show_frame(playback_frame);
+      }
+      ImGui::SameLine();
+      if (ImGui::Button(">")) {
+        playback_frame = std::max(0, std::min(playback_frame + 1, frames - 1));
+        show_frame(playback_frame);
+      }
+      ImGui::SameLine();
+      ImGui::Checkbox("play", &playing);
+
+      if (playing) {
+        if (playback_frame + 1 < frames) {
+          show_frame(++playback_frame);
+        } else {
+          playing = false;
+        }
+      }
+      ImGui::Text("Step %d, time %.4f, %d frames",
+          playback->step(playback_frame), playback->time(playback_frame),
+          frames);
+    }
+
     virtual void callback() {
 
-      static bool export_obj = false;
-      static bool export_mesh = false;
+      if (playback) {
+        playback_callback();
+        return;
+      }
+
+      static bool export_frames = false;
       static bool export_sim_substeps = false;
       static bool simulating = false;
       static int step = 0;
-      static int export_step = 0;
+      static double time = 0;
       static int max_steps = 300;
+      static int frame_encoding = FRAME_DOUBLE;
 
       ImGui::PushItemWidth(100);
 
 
-      ImGui::Checkbox("export obj",&export_obj);
+      ImGui::Checkbox("export frames",&export_frames);
       ImGui::SameLine();
       ImGui::Checkbox("export substeps",&config->save_substeps);
       ImGui::SameLine();
-      ImGui::Checkbox("export mesh",&export_mesh);
+      ImGui::Combo("Encoding", &frame_encoding,
+          "double\0float\0quantized\0\0");
+
+      // Closing the writer finishes the file
+      if (!export_frames) {
+        frame_writer = nullptr;
+      }
 
       if (ImGui::TreeNode("Material Params")) {
 
@@ -153,6 +241,14 @@ namespace mfem {
           config->h2 = config->h*config->h;
           config->ih2 = 1.0/config->h/config->h;
         }
+        if (ImGui::Checkbox("Adaptive Timestep", &config->adaptive_timestep)) {
+          optimizer->reset();
+        }
+        if (config->adaptive_timestep) {
+          ImGui::InputDouble("Min Timestep", &config->h_min, 0,0,"%.5f");
+          ImGui::InputDouble("Max Timestep", &config->h_max, 0,0,"%.5f");
+          ImGui::InputDouble("LTE Tol", &config->lte_tol, 0,0,"%.5g");
+        }
 
         if (FactoryCombo<OptimizerFactory<DIM>, OptimizerType>(
             "Optimizer", config->optimizer)) {
@@ -162,11 +258,23 @@ namespace mfem {
 
         ImGui::InputInt("Max Newton Iters", &config->outer_steps);
         ImGui::InputInt("Max LS Iters", &config->ls_iters);
+        ImGui::Checkbox("Speculative LS", &config->ls_speculative);
         ImGui::InputDouble("Newton Tol", &config->newton_tol,0,0,"%.5g");
 
+        if (config->solver_type != SolverType::SOLVER_AFFINE_PCG) {
+          if (ImGui::Checkbox("Lagged Factorization",
+              &config->lagged_factorization)) {
+            optimizer->reset();
+          }
+        }
+
         if (config->solver_type == SolverType::SOLVER_AFFINE_PCG) {
           ImGui::InputInt("Max CG Iters", &config->max_iterative_solver_iters);
           ImGui::InputDouble("CG Tol", &config->itr_tol,0,0,"%.5g");
+          ImGui::Checkbox("Inexact Newton", &config->inexact_newton);
+          if (ImGui::Checkbox("Matrix-free", &config->matrix_free)) {
+            optimizer->reset();
+          }
         }
 
         if (ImGui::InputFloat3("Body Force", config->ext, 3)) {
@@ -184,7 +292,11 @@ namespace mfem {
           ImGui::InputDouble("kappa", &config->kappa,0,0,"%.5g");
         }
         // ImGui::Checkbox("floor collision",&config->floor_collision);
-        // ImGui::Checkbox("warm start",&config->warm_start);
+        ImGui::Checkbox("Warm Start", &config->warm_start);
+        if (config->optimizer == OPTIMIZER_SQP_PD) {
+          ImGui::Checkbox("Warm Start Multipliers",
+              &config->warm_start_multipliers);
+        }
 
 
         int type = config->bc_type;
@@ -214,6 +326,22 @@ namespace mfem {
             "Linear Solver", config->solver_type)) {
           optimizer->reset();
         }
+        if (ImGui::Checkbox("Symmetric storage",
+            &config->symmetric_storage)) {
+          optimizer->reset();
+        }
+        if (ImGui::Checkbox("Block storage", &config->block_storage)) {
+          optimizer->reset();
+        }
+
+        const char* precisions[] = {"double", "mixed", "single"};
+        int precision = config->system_precision;
+        if (ImGui::Combo("System precision", &precision, precisions,
+            IM_ARRAYSIZE(precisions))) {
+          config->system_precision =
+              static_cast<SystemPrecisionType>(precision);
+          optimizer->reset();
+        }
 
         if (FactoryCombo<IntegratorFactory, TimeIntegratorType>(
             "Integrator", config->ti_type)) {
@@ -233,6 +361,9 @@ namespace mfem {
         std::cout << "Timestep: " << step << std::endl;
         simulation_step();
         ++step;
+        auto h = optimizer->data().map_.find("h");
+        time += h != optimizer->data().map_.end() ? h->second.back()
+                                                  : config->h;
 
         if (DIM == 3) {
           srf->updateVertexPositions(meshV);
@@ -244,23 +375,15 @@ namespace mfem {
           srf_skin->updateVertexPositions(skinV);
         }
 
-        if (export_obj) {
-          char buffer [50];
-          int n = sprintf(buffer, "../output/obj/tet_%04d.obj", export_step++); 
-          buffer[n] = 0;
-          if (skinV.rows() > 0)
-            igl::writeOBJ(std::string(buffer),skinV,skinF);
-          else
-            igl::writeOBJ(std::string(buffer),meshV,meshF);
-        }
-        if (export_mesh) {
-          char buffer [50];
-          int n = sprintf(buffer, "../output/mesh/tet_%04d.mesh", step); 
-          buffer[n] = 0;
-          igl::writeMESH(std::string(buffer),meshV, meshT, meshF);
-          std::ofstream outfile;
-          outfile.open(std::string(buffer), std::ios_base::app); 
-          outfile << "End"; 
+        if (export_frames) {
+          if (!frame_writer) {
+            FrameCacheOptions options;
+            options.encoding = static_cast<FrameEncoding>(frame_encoding);
+            frame_writer = std::make_shared<FrameCacheWriter>(
+                "../output/frames.bin", mesh->V0_,
+                meshT.size() > 0 ? meshT : meshF, options);
+          }
+          frame_writer->write(step, time, meshV);
         }
 
         if (config->save_substeps) {
@@ -301,8 +424,9 @@ namespace mfem {
         } else {
           srf->updateVertexPositions(mesh->V0_);
         }
-        export_step = 0;
+        frame_writer = nullptr;
         step = 0;
+        time = 0;
       }
       if (step >= max_steps) {
         simulating = false;
@@ -321,6 +445,14 @@ namespace mfem {
     Eigen::SparseMatrixd lbs; // linear blend skinning matrix
     Eigen::VectorXd x0, v;
 
+    // Records the frames while "export frames" is enabled. Shared since
+    // the app is copied into the polyscope callback.
+    std::shared_ptr<FrameCacheWriter> frame_writer;
+
+    // Recorded frames being played back, if any
+    std::shared_ptr<FrameCacheReader> playback;
+    int playback_frame = 0;
+
     MaterialModelFactory material_factory;
     OptimizerFactory<DIM> optimizer_factory;
     SolverFactory solver_factory;
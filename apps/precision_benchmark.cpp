@@ -0,0 +1,140 @@
+// Compares the double, mixed and single system precision modes (see
+// SystemPrecisionType) on tetrahedral meshes. For each mode the same
+// scene is simulated and the Newton iteration counts, final decrements,
+// step times and deviation of the final vertices from the double
+// precision result are reported.
+//
+// Example: ./bin/precision_benchmark ../models/coarse_bunny.mesh
+//     ../models/beam.mesh -n 50
+
+#include <igl/readMESH.h>
+#include "args/args.hxx"
+
+#include "mesh/tet_mesh.h"
+#include "optimizers/optimizer.h"
+#include "energies/material_model.h"
+#include "factories/optimizer_factory.h"
+#include "factories/material_model_factory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  struct BenchmarkResult {
+    double seconds = 0;    // total simulation time
+    double iters = 0;      // average Newton iterations per step
+    double decrement = 0;  // largest final Newton decrement over all steps
+    MatrixXd V;            // final vertices
+  };
+
+  BenchmarkResult run(const MatrixXd& V, const MatrixXi& T,
+      SystemPrecisionType precision, SolverType solver, int steps) {
+    std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+    config->system_precision = precision;
+    config->solver_type = solver;
+    config->bc_type = BC_HANG;
+    config->show_data = false;
+    config->show_timing = false;
+
+    std::shared_ptr<MaterialConfig> material_config =
+        std::make_shared<MaterialConfig>();
+    MaterialModelFactory material_factory;
+    std::shared_ptr<MaterialModel> material = material_factory.create(
+        material_config->material_model, material_config);
+
+    std::shared_ptr<Mesh> mesh = std::make_shared<TetrahedralMesh>(V, T,
+        material, material_config);
+
+    OptimizerFactory<3> optimizer_factory;
+    std::shared_ptr<Optimizer<3>> optimizer = optimizer_factory.create(
+        config->optimizer, mesh, config);
+    optimizer->reset();
+
+    BenchmarkResult result;
+    for (int i = 0; i < steps; ++i) {
+      auto start = std::chrono::high_resolution_clock::now();
+      optimizer->step();
+      auto end = std::chrono::high_resolution_clock::now();
+      result.seconds += std::chrono::duration<double>(end - start).count();
+
+      const auto& data = optimizer->data().map_;
+      auto it = data.find("Newton dec");
+      if (it != data.end() && !it->second.empty()) {
+        result.iters += it->second.size();
+        result.decrement = std::max(result.decrement, it->second.back());
+      }
+    }
+    result.iters /= std::max(steps, 1);
+    result.V = mesh->vertices();
+    return result;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  args::ArgumentParser parser("Mixed FEM precision benchmark");
+  args::PositionalList<std::string> files_arg(parser, "<file>.mesh",
+      "tetrahedral meshes");
+  args::ValueFlag<int> steps_arg(parser, "integer", "number of timesteps",
+      {'n'});
+  args::Flag ldlt_arg(parser, "ldlt", "use eigen-ldlt instead of eigen-llt",
+      {"ldlt"});
+
+  try {
+    parser.ParseCLI(argc, argv);
+  } catch (args::Help) {
+    std::cout << parser;
+    return 0;
+  } catch (args::ParseError e) {
+    std::cerr << e.what() << std::endl;
+    std::cerr << parser;
+    return 1;
+  }
+
+  std::vector<std::string> files = args::get(files_arg);
+  if (files.empty()) {
+    files = {"../models/coarse_bunny.mesh", "../models/beam.mesh"};
+  }
+  int steps = steps_arg ? args::get(steps_arg) : 50;
+  SolverType solver = ldlt_arg ? SOLVER_EIGEN_LDLT : SOLVER_EIGEN_LLT;
+
+  const std::vector<std::pair<SystemPrecisionType, std::string>> modes = {
+    {SYSTEM_DOUBLE, "double"},
+    {SYSTEM_MIXED, "mixed"},
+    {SYSTEM_SINGLE, "single"}
+  };
+
+  for (const std::string& file : files) {
+    MatrixXd V;
+    MatrixXi T, F;
+    if (!igl::readMESH(file, V, T, F)) {
+      std::cerr << "Failed to read " << file << std::endl;
+      continue;
+    }
+    V.array() /= V.maxCoeff();
+    double diag = (V.colwise().maxCoeff() - V.colwise().minCoeff()).norm();
+
+    std::cout << file << ": " << V.rows() << " vertices, " << T.rows()
+        << " elements, " << steps << " steps" << std::endl;
+    printf("  %-8s %12s %12s %14s %14s\n", "mode", "ms/step", "iters/step",
+        "max decrement", "rel. error");
+
+    MatrixXd V_ref;
+    for (const auto& [precision, name] : modes) {
+      BenchmarkResult result = run(V, T, precision, solver, steps);
+      if (precision == SYSTEM_DOUBLE) {
+        V_ref = result.V;
+      }
+      double error = (result.V - V_ref).rowwise().norm().maxCoeff() / diag;
+      printf("  %-8s %12.3f %12.2f %14.3e %14.3e\n", name.c_str(),
+          1e3 * result.seconds / steps, result.iters, result.decrement,
+          error);
+    }
+  }
+  return 0;
+}
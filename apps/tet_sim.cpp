@@ -8,6 +8,7 @@
 #include <igl/barycentric_coordinates.h>
 
 #include "boundary_conditions.h"
+#include "precompute_cache.h"
 #include <sstream>
 #include <fstream>
 #include <functional>
@@ -63,9 +64,37 @@ struct PolyscopeTetApp : public PolyscopeApp<3> {
   }
 
 
+  // Read a .mesh file, reusing a parsed copy from the cache directory if
+  // the file contents are unchanged.
+  void read_mesh(const std::string& filename) {
+    if (cache_dir.empty()) {
+      igl::readMESH(filename, meshV, meshT, meshF);
+      return;
+    }
+
+    std::ifstream file(filename, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+    uint64_t key = hash_bytes(contents.data(), contents.size());
+    std::string path = cache_path(cache_dir, "meshfile", key);
+
+    CacheReader reader(path, key);
+    if (reader.good() && reader.read(meshV) && reader.read(meshT)
+        && reader.read(meshF)) {
+      return;
+    }
+
+    igl::readMESH(filename, meshV, meshT, meshF);
+    CacheWriter writer(path, key);
+    writer.write(meshV);
+    writer.write(meshT);
+    writer.write(meshF);
+    writer.commit();
+  }
+
   void init(const std::string& filename) {
     // Read the mesh
-    igl::readMESH(filename, meshV, meshT, meshF);
+    read_mesh(filename);
     double fac = meshV.maxCoeff();
     meshV.array() /= fac;
     std::cout << "fac: " << fac << std::endl;
@@ -97,6 +126,7 @@ struct PolyscopeTetApp : public PolyscopeApp<3> {
 
     // Initial simulation setup
     config = std::make_shared<SimConfig>();
+    config->cache_dir = cache_dir;
     config->plane_d = a(1);
     config->inner_steps=1;
 
@@ -113,6 +143,8 @@ struct PolyscopeTetApp : public PolyscopeApp<3> {
 
     BoundaryConditions<3>::get_script_names(bc_list);
   }
+
+  std::string cache_dir; // precomputation cache directory, empty if unused
 };
 
 PolyscopeTetApp app;
@@ -128,6 +160,8 @@ int main(int argc, char **argv) {
   args::ValueFlag<std::string> init_mesh(parser, "sim_v_<step>.dmat", "initial mesh", {'r'});
   args::ValueFlag<std::string> x0_arg(parser, "sim_x0_<step>.dmat", "x0 value for step", {"x0"});
   args::ValueFlag<std::string> v_arg(parser, "sim_v_<step>.dmat", "v value for step", {'v'});
+  args::ValueFlag<std::string> cache_arg(parser, "dir", "precomputation cache directory", {"cache"});
+  args::ValueFlag<std::string> play_arg(parser, "frames.bin", "play back recorded frames", {"play"});
 
   // Parse args
   try {
@@ -153,6 +187,9 @@ int main(int argc, char **argv) {
   std::string filename = args::get(inFile);
   std::cout << "loading: " << filename << std::endl;
 
+  if (cache_arg) {
+    app.cache_dir = args::get(cache_arg);
+  }
   app.init(filename);
 
   // Check if initial mesh provided
@@ -184,6 +221,10 @@ int main(int argc, char **argv) {
     app.init_skin(hires_fn);
   }
 
+  if (play_arg && !app.load_playback(args::get(play_arg))) {
+    return 1;
+  }
+
   // Add the callback
   polyscope::state::userCallback = std::bind(&PolyscopeApp<3>::callback, app);
 
@@ -65,6 +65,7 @@ int main(int argc, char **argv) {
   // Configure the argument parser
   args::ArgumentParser parser("Mixed FEM");
   args::Positional<std::string> inFile(parser, "mesh", "input mesh");
+  args::ValueFlag<std::string> play_arg(parser, "frames.bin", "play back recorded frames", {"play"});
 
   // Parse args
   try {
@@ -93,6 +94,10 @@ int main(int argc, char **argv) {
 
   polyscope::view::style = polyscope::view::NavigateStyle::Planar;
 
+  if (play_arg && !app.load_playback(args::get(play_arg))) {
+    return 1;
+  }
+
   // Add the callback
   polyscope::state::userCallback = std::bind(&PolyscopeApp<2>::callback, app);
 
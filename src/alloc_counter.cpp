@@ -0,0 +1,103 @@
+#include "alloc_counter.h"
+
+#include <EigenTypes.h>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+using namespace mfem;
+
+#if defined(SIM_COUNT_ALLOCATIONS)
+
+namespace {
+  std::atomic<size_t> allocations(0);
+
+  void* counted_malloc(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (!p) {
+      throw std::bad_alloc();
+    }
+    return p;
+  }
+
+  void* counted_aligned_malloc(std::size_t size, std::align_val_t al) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(al);
+    std::size_t padded = (size + align - 1) / align * align;
+    void* p = std::aligned_alloc(align, padded == 0 ? align : padded);
+    if (!p) {
+      throw std::bad_alloc();
+    }
+    return p;
+  }
+}
+
+void* operator new(std::size_t size) {
+  return counted_malloc(size);
+}
+
+void* operator new[](std::size_t size) {
+  return counted_malloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t al) {
+  return counted_aligned_malloc(size, al);
+}
+
+void* operator new[](std::size_t size, std::align_val_t al) {
+  return counted_aligned_malloc(size, al);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+size_t mfem::allocation_count() {
+  return allocations.load(std::memory_order_relaxed);
+}
+
+#else
+
+size_t mfem::allocation_count() {
+  return 0;
+}
+
+#endif
+
+NoAllocationScope::NoAllocationScope(const char* name, bool armed)
+    : name_(name), armed_(armed), eigen_allowed_(true),
+      count_(allocation_count()) {
+  #if defined(EIGEN_RUNTIME_NO_MALLOC)
+  if (armed_) {
+    eigen_allowed_ = Eigen::internal::is_malloc_allowed();
+    Eigen::internal::set_is_malloc_allowed(false);
+  }
+  #endif
+}
+
+NoAllocationScope::~NoAllocationScope() {
+  #if defined(EIGEN_RUNTIME_NO_MALLOC)
+  if (armed_) {
+    Eigen::internal::set_is_malloc_allowed(eigen_allowed_);
+  }
+  #endif
+
+  size_t n = allocation_count() - count_;
+  if (armed_ && n > 0) {
+    std::cerr << "NoAllocationScope(" << name_ << "): " << n
+        << " heap allocations" << std::endl;
+    assert(false);
+  }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mfem {
+
+  // Debug accounting of heap allocations, enabled by building with
+  // SIM_COUNT_ALLOCATIONS. Global operator new is replaced to count the
+  // allocations of every thread, and Eigen's dense allocations (which go
+  // through malloc) are caught by EIGEN_RUNTIME_NO_MALLOC.
+
+  // Number of heap allocations made so far. Always zero when counting is
+  // disabled.
+  size_t allocation_count();
+
+  // Asserts that no heap allocations happen during its lifetime. Guards
+  // the sections of the step loop that only touch persistent buffers.
+  // Does nothing unless counting is enabled and the scope is armed, so
+  // callers can skip the first pass that sizes the buffers.
+  class NoAllocationScope {
+  public:
+    NoAllocationScope(const char* name, bool armed = true);
+    ~NoAllocationScope();
+
+    NoAllocationScope(const NoAllocationScope&) = delete;
+    NoAllocationScope& operator=(const NoAllocationScope&) = delete;
+
+  private:
+    const char* name_;
+    bool armed_;
+    bool eigen_allowed_;  // Eigen malloc state to restore on exit
+    size_t count_;        // allocation count on entry
+  };
+
+}
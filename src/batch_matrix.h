@@ -0,0 +1,306 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include <algorithm>
+#include <vector>
+
+namespace mfem {
+
+  // Number of elements processed together by the batched element kernels.
+  // One lane group fills a SIMD register of doubles (or two on targets
+  // narrower than AVX).
+  #if defined(__AVX512F__)
+  constexpr int BATCH_WIDTH = 8;
+  #else
+  constexpr int BATCH_WIDTH = 4;
+  #endif
+
+  // RxC matrices of a group of W elements. The W values of each entry are
+  // contiguous (entries are column-major), so kernels that loop over the
+  // lanes of an entry vectorize across elements.
+  template <typename Scalar, int R, int C, int W = BATCH_WIDTH>
+  struct LaneMatrix {
+
+    using Matrix = Eigen::Matrix<Scalar, R, C>;
+
+    alignas(64) Scalar v[R*C][W];
+
+    // The W lanes of entry (i,j)
+    Scalar* operator()(int i, int j) { return v[j*R + i]; }
+    const Scalar* operator()(int i, int j) const { return v[j*R + i]; }
+
+    // Matrix of the l-th element in the group
+    Matrix get(int l) const {
+      Matrix A;
+      for (int k = 0; k < R*C; ++k) {
+        A.data()[k] = v[k][l];
+      }
+      return A;
+    }
+
+    template <typename Derived>
+    void set(int l, const Eigen::MatrixBase<Derived>& A) {
+      for (int j = 0; j < C; ++j) {
+        for (int i = 0; i < R; ++i) {
+          v[j*R + i][l] = A(i,j);
+        }
+      }
+    }
+  };
+
+  // Per-element RxC matrices in structure-of-arrays layout. Elements are
+  // stored in lane groups of W, and the element count is padded to a
+  // multiple of W so every group is full.
+  template <typename Scalar, int R, int C, int W = BATCH_WIDTH>
+  class BatchMatrix {
+  public:
+
+    using Lanes = LaneMatrix<Scalar, R, C, W>;
+    using Matrix = typename Lanes::Matrix;
+
+    void resize(int n) {
+      n_ = n;
+      batches_.resize((n + W - 1) / W);
+    }
+
+    // Number of elements (excluding padding)
+    int size() const { return n_; }
+
+    // Number of lane groups
+    int batches() const { return batches_.size(); }
+
+    // Number of elements in group b that are not padding
+    int lanes(int b) const { return std::min(W, n_ - b*W); }
+
+    Lanes& batch(int b) { return batches_[b]; }
+    const Lanes& batch(int b) const { return batches_[b]; }
+
+    // Copy of the i-th element's matrix
+    Matrix operator[](int i) const {
+      return batches_[i / W].get(i % W);
+    }
+
+    template <typename Derived>
+    void set(int i, const Eigen::MatrixBase<Derived>& A) {
+      batches_[i / W].set(i % W, A);
+    }
+
+    // Set every element, including padding, to A
+    template <typename Derived>
+    void fill(const Eigen::MatrixBase<Derived>& A) {
+      for (Lanes& lanes : batches_) {
+        for (int l = 0; l < W; ++l) {
+          lanes.set(l, A);
+        }
+      }
+    }
+
+  private:
+    int n_ = 0;
+    std::vector<Lanes> batches_;
+  };
+
+  // Kernels on lane groups. Each applies the same small dense operation
+  // to all W elements of a group. Outputs must not alias inputs.
+
+  // out = A * B
+  template <typename Scalar, int R, int K, int C, int W>
+  void lane_multiply(const LaneMatrix<Scalar,R,K,W>& A,
+      const LaneMatrix<Scalar,K,C,W>& B, LaneMatrix<Scalar,R,C,W>& out) {
+    for (int j = 0; j < C; ++j) {
+      for (int i = 0; i < R; ++i) {
+        Scalar* o = out(i,j);
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          o[l] = 0;
+        }
+        for (int k = 0; k < K; ++k) {
+          const Scalar* a = A(i,k);
+          const Scalar* b = B(k,j);
+          #pragma omp simd
+          for (int l = 0; l < W; ++l) {
+            o[l] += a[l] * b[l];
+          }
+        }
+      }
+    }
+  }
+
+  // out = A * B^T
+  template <typename Scalar, int R, int K, int C, int W>
+  void lane_multiply_transpose(const LaneMatrix<Scalar,R,K,W>& A,
+      const LaneMatrix<Scalar,C,K,W>& B, LaneMatrix<Scalar,R,C,W>& out) {
+    for (int j = 0; j < C; ++j) {
+      for (int i = 0; i < R; ++i) {
+        Scalar* o = out(i,j);
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          o[l] = 0;
+        }
+        for (int k = 0; k < K; ++k) {
+          const Scalar* a = A(i,k);
+          const Scalar* b = B(j,k);
+          #pragma omp simd
+          for (int l = 0; l < W; ++l) {
+            o[l] += a[l] * b[l];
+          }
+        }
+      }
+    }
+  }
+
+  // out = A^T * B
+  template <typename Scalar, int R, int K, int C, int W>
+  void lane_transpose_multiply(const LaneMatrix<Scalar,K,R,W>& A,
+      const LaneMatrix<Scalar,K,C,W>& B, LaneMatrix<Scalar,R,C,W>& out) {
+    for (int j = 0; j < C; ++j) {
+      for (int i = 0; i < R; ++i) {
+        Scalar* o = out(i,j);
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          o[l] = 0;
+        }
+        for (int k = 0; k < K; ++k) {
+          const Scalar* a = A(k,i);
+          const Scalar* b = B(k,j);
+          #pragma omp simd
+          for (int l = 0; l < W; ++l) {
+            o[l] += a[l] * b[l];
+          }
+        }
+      }
+    }
+  }
+
+  // Inverse of symmetric positive definite matrices by Gauss-Jordan
+  // elimination. Pivoting is unnecessary for SPD inputs, which keeps the
+  // elimination identical across lanes.
+  template <typename Scalar, int N, int W>
+  void lane_inverse_spd(const LaneMatrix<Scalar,N,N,W>& A,
+      LaneMatrix<Scalar,N,N,W>& Ainv) {
+    LaneMatrix<Scalar,N,N,W> L = A;
+    for (int j = 0; j < N; ++j) {
+      for (int i = 0; i < N; ++i) {
+        Scalar* o = Ainv(i,j);
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          o[l] = (i == j) ? 1 : 0;
+        }
+      }
+    }
+
+    alignas(64) Scalar pivot[W];
+    alignas(64) Scalar f[W];
+    for (int k = 0; k < N; ++k) {
+      #pragma omp simd
+      for (int l = 0; l < W; ++l) {
+        pivot[l] = Scalar(1) / L(k,k)[l];
+      }
+      for (int j = 0; j < N; ++j) {
+        Scalar* lkj = L(k,j);
+        Scalar* ikj = Ainv(k,j);
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          lkj[l] *= pivot[l];
+          ikj[l] *= pivot[l];
+        }
+      }
+
+      for (int i = 0; i < N; ++i) {
+        if (i == k) {
+          continue;
+        }
+        #pragma omp simd
+        for (int l = 0; l < W; ++l) {
+          f[l] = L(i,k)[l];
+        }
+        for (int j = 0; j < N; ++j) {
+          Scalar* lij = L(i,j);
+          Scalar* iij = Ainv(i,j);
+          const Scalar* lkj = L(k,j);
+          const Scalar* ikj = Ainv(k,j);
+          #pragma omp simd
+          for (int l = 0; l < W; ++l) {
+            lij[l] -= f[l] * lkj[l];
+            iij[l] -= f[l] * ikj[l];
+          }
+        }
+      }
+    }
+  }
+
+  // Element l of a lane group accessed like a fixed-size Eigen matrix, so
+  // element kernels written as templates over their input and output
+  // types run unchanged on a single element or on one lane of a group.
+  template <typename Lanes>
+  struct LaneRef {
+    Lanes& A;
+    int l;
+
+    auto& operator()(int i, int j = 0) const { return A(i,j)[l]; }
+
+    void setZero() const {
+      for (auto& entry : A.v) {
+        entry[l] = 0;
+      }
+    }
+  };
+
+  // Runs kernel(in, out) on every lane of a group. This is deliberately a
+  // plain loop: once the kernel inlines, the auto-vectorizer maps the lanes
+  // onto SIMD registers, whereas `omp simd` privatizes the LaneRefs into
+  // arrays and gives up.
+  template <typename Scalar, int R, int C, int R2, int C2, int W,
+      typename Kernel>
+  void lane_apply(const LaneMatrix<Scalar,R,C,W>& in,
+      LaneMatrix<Scalar,R2,C2,W>& out, Kernel kernel) {
+    for (int l = 0; l < W; ++l) {
+      LaneRef<const LaneMatrix<Scalar,R,C,W>> a{in, l};
+      LaneRef<LaneMatrix<Scalar,R2,C2,W>> b{out, l};
+      kernel(a, b);
+    }
+  }
+
+  // Scalar-valued kernel: out[l] = kernel(in)
+  template <typename Scalar, int R, int C, int W, typename Kernel>
+  void lane_apply(const LaneMatrix<Scalar,R,C,W>& in, Scalar* out,
+      Kernel kernel) {
+    for (int l = 0; l < W; ++l) {
+      LaneRef<const LaneMatrix<Scalar,R,C,W>> a{in, l};
+      out[l] = kernel(a);
+    }
+  }
+
+  // Gather the R-sized per-element segments of x for group b. Lanes past
+  // the last of the n elements are zero.
+  template <typename Scalar, int R, int W>
+  void lane_load(const Eigen::VectorXx<Scalar>& x, int b, int n,
+      LaneMatrix<Scalar,R,1,W>& out) {
+    int lanes = std::min(W, n - b*W);
+    const Scalar* src = x.data() + R*W*b;
+    for (int i = 0; i < R; ++i) {
+      Scalar* o = out(i,0);
+      for (int l = 0; l < lanes; ++l) {
+        o[l] = src[R*l + i];
+      }
+      for (int l = lanes; l < W; ++l) {
+        o[l] = 0;
+      }
+    }
+  }
+
+  // Scatter group b into the R-sized per-element segments of x
+  template <typename Scalar, int R, int W>
+  void lane_store(const LaneMatrix<Scalar,R,1,W>& in, int b, int n,
+      Eigen::VectorXx<Scalar>& x) {
+    int lanes = std::min(W, n - b*W);
+    Scalar* dst = x.data() + R*W*b;
+    for (int i = 0; i < R; ++i) {
+      const Scalar* v = in(i,0);
+      for (int l = 0; l < lanes; ++l) {
+        dst[R*l + i] = v[l];
+      }
+    }
+  }
+
+}
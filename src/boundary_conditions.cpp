@@ -373,8 +373,7 @@ void BoundaryConditions<DIM>::init_script(std::shared_ptr<Mesh> &mesh)
 template <int DIM>
 int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
 {
-  VectorXd searchDir(mesh->V_.rows() * DIM);
-  searchDir.setZero();
+  searchDir_.setZero(mesh->V_.rows() * DIM);
   int returnFlag = 0;
   switch (script_type_)
   {
@@ -389,7 +388,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
   case BC_SQUASH:
     for (const auto &movingVerts : group_velocity_)
     {
-      searchDir.segment<DIM>(movingVerts.first * DIM) =
+      searchDir_.segment<DIM>(movingVerts.first * DIM) =
           movingVerts.second * dt;
     }
     break;
@@ -410,7 +409,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       {
         movingVerts.second[0] *= -1.0;
       }
-      searchDir.segment<DIM>(movingVerts.first * DIM) =
+      searchDir_.segment<DIM>(movingVerts.first * DIM) =
           movingVerts.second * dt;
     }
     break;
@@ -426,7 +425,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       const auto rotCenter = rotCenter_bc_groups_.find(movingVerts.first);
       assert(rotCenter != rotCenter_bc_groups_.end());
 
-      searchDir.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
+      searchDir_.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
     }
     break;
 
@@ -440,7 +439,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       const auto rotCenter = rotCenter_bc_groups_.find(movingVerts.first);
       assert(rotCenter != rotCenter_bc_groups_.end());
 
-      searchDir.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
+      searchDir_.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
     }
     break;
 
@@ -455,11 +454,11 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       const auto rotCenter = rotCenter_bc_groups_.find(movingVerts.first);
       assert(rotCenter != rotCenter_bc_groups_.end());
 
-      searchDir.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
+      searchDir_.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
     }
     for (const auto &movingVerts : group_velocity_)
     {
-      searchDir.segment<DIM>(movingVerts.first * DIM) += movingVerts.second * dt;
+      searchDir_.segment<DIM>(movingVerts.first * DIM) += movingVerts.second * dt;
     }
     break;
   }
@@ -489,7 +488,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       const auto rotCenter = rotCenter_bc_groups_.find(movingVerts.first);
       assert(rotCenter != rotCenter_bc_groups_.end());
 
-      searchDir.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
+      searchDir_.segment<DIM>(movingVerts.first * DIM) = (rotMtr.block<DIM, DIM>(0, 0) * (mesh->V_.row(movingVerts.first).transpose() - rotCenter->second) + rotCenter->second) - mesh->V_.row(movingVerts.first).transpose();
     }
     for (auto &movingVerts : group_velocity_)
     {
@@ -497,7 +496,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
       {
         movingVerts.second[0] *= -1.0;
       }
-      searchDir.segment<DIM>(movingVerts.first * DIM) += movingVerts.second * dt;
+      searchDir_.segment<DIM>(movingVerts.first * DIM) += movingVerts.second * dt;
     }
     break;
   }
@@ -521,7 +520,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
     }
     for (const auto &movingVerts : group_velocity_)
     {
-      searchDir.segment<DIM>(movingVerts.first * DIM) =
+      searchDir_.segment<DIM>(movingVerts.first * DIM) =
           movingVerts.second * dt;
     }
     break;
@@ -545,7 +544,7 @@ int BoundaryConditions<DIM>::step_script(std::shared_ptr<Mesh> &mesh, double dt)
   #pragma omp parallel for
   for (int vI = 0; vI < mesh->V_.rows(); ++vI)
   {
-    mesh->V_.row(vI) += stepSize * searchDir.segment<DIM>(vI * DIM).transpose();
+    mesh->V_.row(vI) += stepSize * searchDir_.segment<DIM>(vI * DIM).transpose();
   }
 
   return returnFlag;
@@ -557,6 +556,61 @@ void BoundaryConditions<DIM>::set_script(BCScriptType script_type)
   script_type_ = script_type;
 }
 
+template <int DIM>
+void BoundaryConditions<DIM>::save_state(Checkpoint &ckpt) const
+{
+  MatrixXd velocity(DIM + 1, group_velocity_.size());
+  int i = 0;
+  for (const auto &movingVerts : group_velocity_)
+  {
+    velocity(0, i) = movingVerts.first;
+    velocity.col(i++).tail<DIM>() = movingVerts.second;
+  }
+
+  VectorXd turning(1 + 2 * DIM);
+  turning(0) = velocity_turning_points_.first;
+  turning.tail(2 * DIM) = velocity_turning_points_.second.reshaped();
+
+  ckpt.set("bc/script", Matrix<double, 1, 1>(script_type_));
+  ckpt.set("bc/group_velocity", velocity);
+  ckpt.set("bc/turning_points", turning);
+}
+
+template <int DIM>
+bool BoundaryConditions<DIM>::check_state(const Checkpoint &ckpt) const
+{
+  MatrixXd script, velocity;
+  VectorXd turning;
+  return ckpt.get("bc/script", script) && script.size() == 1
+      && script(0) == script_type_
+      && ckpt.get("bc/group_velocity", velocity) && velocity.rows() == DIM + 1
+      && ckpt.get("bc/turning_points", turning)
+      && turning.size() == 1 + 2 * DIM;
+}
+
+template <int DIM>
+bool BoundaryConditions<DIM>::load_state(const Checkpoint &ckpt)
+{
+  if (!check_state(ckpt))
+  {
+    return false;
+  }
+
+  MatrixXd velocity;
+  VectorXd turning;
+  ckpt.get("bc/group_velocity", velocity);
+  ckpt.get("bc/turning_points", turning);
+
+  group_velocity_.clear();
+  for (int i = 0; i < velocity.cols(); ++i)
+  {
+    group_velocity_[int(velocity(0, i))] = velocity.col(i).tail<DIM>();
+  }
+  velocity_turning_points_.first = int(turning(0));
+  velocity_turning_points_.second = turning.tail(2 * DIM).reshaped(DIM, 2);
+  return true;
+}
+
 template <int DIM>
 const std::vector<std::vector<int>> &BoundaryConditions<DIM>::get_bc_groups(void) const
 {
@@ -4,6 +4,7 @@
 #include <EigenTypes.h>
 #include <memory>
 #include "config.h"
+#include "checkpoint.h"
 
 namespace mfem
 {
@@ -27,6 +28,8 @@ namespace mfem
     std::map<int, double> angVel_bc_groups_;
     std::map<int, Eigen::Matrix<double, DIM, 1>> rotCenter_bc_groups_;
 
+    Eigen::VectorXd searchDir_; // per-vertex displacements of a script step
+
     static const std::vector<std::string> script_type_strings;
 
   public:
@@ -39,6 +42,14 @@ namespace mfem
     int step_script(std::shared_ptr<Mesh> &mesh, double dt);
     void set_script(BCScriptType script_type);
 
+    // Saves and restores the script state that changes while stepping
+    // (velocities of moving groups and turning points). load_state()
+    // returns false if the checkpoint was saved for a different script.
+    // check_state() validates the checkpoint without restoring it.
+    void save_state(Checkpoint& ckpt) const;
+    bool check_state(const Checkpoint& ckpt) const;
+    bool load_state(const Checkpoint& ckpt);
+
     const std::vector<std::vector<int>> &get_bc_groups(void) const;
 
     static BCScriptType get_script_type(const std::string &str);
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include <algorithm>
+#include <vector>
+
+namespace mfem {
+
+  // Block compressed sparse row matrix with fixed size BxB blocks.
+  // Stores one column index per block rather than per entry, and each
+  // block's values are contiguous (column-major) so products with the
+  // matrix operate on small fixed size blocks. Symmetric matrices store
+  // both triangles.
+  // Scalar {double, float}
+  // B      {2, 3} block size
+  template <typename Scalar, int B>
+  class BSRMatrix {
+  public:
+
+    using Block = Eigen::Matrix<Scalar, B, B>;
+
+    BSRMatrix() : block_rows_(0), block_cols_(0) {}
+
+    // Initialize sparsity pattern. Values are set to zero.
+    // block_rows  - number of block rows
+    // block_cols  - number of block columns
+    // outer       - |block_rows + 1| offsets into inner for each block row
+    // inner       - block column indices, sorted within each block row
+    BSRMatrix(int block_rows, int block_cols, const std::vector<int>& outer,
+        const std::vector<int>& inner)
+        : block_rows_(block_rows), block_cols_(block_cols), outer_(outer),
+          inner_(inner) {
+      assert(outer_.size() == static_cast<size_t>(block_rows_ + 1));
+      values_.assign(B*B*inner_.size(), 0);
+      init_transpose();
+    }
+
+    int rows() const { return B * block_rows_; }
+    int cols() const { return B * block_cols_; }
+    int block_rows() const { return block_rows_; }
+    int block_cols() const { return block_cols_; }
+    int non_zero_blocks() const { return inner_.size(); }
+
+    const std::vector<int>& outer_index() const { return outer_; }
+    const std::vector<int>& inner_index() const { return inner_; }
+
+    Scalar* values() { return values_.data(); }
+    const Scalar* values() const { return values_.data(); }
+
+    // k-th stored block
+    Eigen::Map<Block> block(int k) {
+      return Eigen::Map<Block>(values_.data() + B*B*k);
+    }
+    Eigen::Map<const Block> block(int k) const {
+      return Eigen::Map<const Block>(values_.data() + B*B*k);
+    }
+
+    // Add the values of a matrix with the same sparsity pattern
+    BSRMatrix& operator+=(const BSRMatrix& other) {
+      assert(other.inner_ == inner_);
+      const Scalar* src = other.values_.data();
+      Scalar* dst = values_.data();
+      const int n = values_.size();
+
+      #pragma omp parallel for
+      for (int i = 0; i < n; ++i) {
+        dst[i] += src[i];
+      }
+      return *this;
+    }
+
+    // Set the values from a scalar sparse matrix (full storage) whose
+    // nonzeros lie within the block pattern. Values outside of A's
+    // pattern are zeroed.
+    void set_values(const Eigen::SparseMatrix<Scalar, Eigen::RowMajor>& A) {
+      assert(A.rows() == rows() && A.cols() == cols());
+      std::fill(values_.begin(), values_.end(), Scalar(0));
+
+      #pragma omp parallel for
+      for (int r = 0; r < A.rows(); ++r) {
+        const int i = r / B;
+        const int* beg = inner_.data() + outer_[i];
+        const int* end = inner_.data() + outer_[i+1];
+        for (typename Eigen::SparseMatrix<Scalar, Eigen::RowMajor>::
+            InnerIterator it(A, r); it; ++it) {
+          const int* k = std::lower_bound(beg, end, it.col() / B);
+          assert(k != end && *k == it.col() / B);
+          block(k - inner_.data())(r % B, it.col() % B) = it.value();
+        }
+      }
+    }
+
+    // y = A * x
+    void multiply(const Eigen::VectorXx<Scalar>& x,
+        Eigen::VectorXx<Scalar>& y) const {
+      assert(x.size() == cols());
+      y.resize(rows());
+
+      #pragma omp parallel for
+      for (int i = 0; i < block_rows_; ++i) {
+        Eigen::Matrix<Scalar, B, 1> yi = Eigen::Matrix<Scalar, B, 1>::Zero();
+        for (int k = outer_[i]; k < outer_[i+1]; ++k) {
+          yi.noalias() += block(k) * x.template segment<B>(B*inner_[k]);
+        }
+        y.template segment<B>(B*i) = yi;
+      }
+    }
+
+    // y = A^T * x
+    // Uses the transposed block index built with the sparsity pattern
+    // so each thread gathers its own output block.
+    void transpose_multiply(const Eigen::VectorXx<Scalar>& x,
+        Eigen::VectorXx<Scalar>& y) const {
+      assert(x.size() == rows());
+      y.resize(cols());
+
+      #pragma omp parallel for
+      for (int j = 0; j < block_cols_; ++j) {
+        Eigen::Matrix<Scalar, B, 1> yj = Eigen::Matrix<Scalar, B, 1>::Zero();
+        for (int k = t_outer_[j]; k < t_outer_[j+1]; ++k) {
+          yj.noalias() += block(t_ids_[k]).transpose()
+              * x.template segment<B>(B*t_inner_[k]);
+        }
+        y.template segment<B>(B*j) = yj;
+      }
+    }
+
+    // Product with a dense vector or matrix, column by column.
+    template <typename Derived>
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime>
+    operator*(const Eigen::MatrixBase<Derived>& x) const {
+      Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> out(
+          rows(), x.cols());
+      Eigen::VectorXx<Scalar> xi, yi;
+      for (int i = 0; i < x.cols(); ++i) {
+        xi = x.col(i);
+        multiply(xi, yi);
+        out.col(i) = yi;
+      }
+      return out;
+    }
+
+    // Diagonal BxB blocks. Blocks absent from the pattern are zero.
+    void block_diagonal(std::vector<Block>& diag) const {
+      diag.resize(block_rows_);
+
+      #pragma omp parallel for
+      for (int i = 0; i < block_rows_; ++i) {
+        const int* beg = inner_.data() + outer_[i];
+        const int* end = inner_.data() + outer_[i+1];
+        const int* it = std::lower_bound(beg, end, i);
+        if (it != end && *it == i) {
+          diag[i] = block(it - inner_.data());
+        } else {
+          diag[i].setZero();
+        }
+      }
+    }
+
+    // Scalar diagonal entries
+    Eigen::VectorXx<Scalar> diagonal() const {
+      std::vector<Block> diag;
+      block_diagonal(diag);
+      Eigen::VectorXx<Scalar> d(rows());
+      for (int i = 0; i < block_rows_; ++i) {
+        d.template segment<B>(B*i) = diag[i].diagonal();
+      }
+      return d;
+    }
+
+    // Expand to scalar compressed row storage (e.g. for direct solvers)
+    Eigen::SparseMatrix<Scalar, Eigen::RowMajor> to_csr() const {
+      Eigen::SparseMatrix<Scalar, Eigen::RowMajor> A(rows(), cols());
+      A.resizeNonZeros(B*B*inner_.size());
+
+      int* outer = A.outerIndexPtr();
+      int* inner = A.innerIndexPtr();
+      Scalar* values = A.valuePtr();
+
+      outer[rows()] = B*B*inner_.size();
+
+      #pragma omp parallel for
+      for (int i = 0; i < block_rows_; ++i) {
+        int nblocks = outer_[i+1] - outer_[i];
+        for (int r = 0; r < B; ++r) {
+          int row_beg = B*B*outer_[i] + r*B*nblocks;
+          outer[B*i + r] = row_beg;
+
+          for (int k = outer_[i]; k < outer_[i+1]; ++k) {
+            int idx = row_beg + B*(k - outer_[i]);
+            for (int c = 0; c < B; ++c) {
+              inner[idx + c] = B*inner_[k] + c;
+              values[idx + c] = block(k)(r,c);
+            }
+          }
+        }
+      }
+      return A;
+    }
+
+  private:
+
+    // Column-oriented index of the blocks used by transpose_multiply
+    void init_transpose() {
+      t_outer_.assign(block_cols_ + 1, 0);
+      for (int k : inner_) {
+        ++t_outer_[k + 1];
+      }
+      for (int j = 0; j < block_cols_; ++j) {
+        t_outer_[j + 1] += t_outer_[j];
+      }
+
+      t_inner_.resize(inner_.size());
+      t_ids_.resize(inner_.size());
+      std::vector<int> fill(t_outer_.begin(), t_outer_.end() - 1);
+      for (int i = 0; i < block_rows_; ++i) {
+        for (int k = outer_[i]; k < outer_[i+1]; ++k) {
+          int pos = fill[inner_[k]]++;
+          t_inner_[pos] = i;
+          t_ids_[pos] = k;
+        }
+      }
+    }
+
+    int block_rows_;
+    int block_cols_;
+    std::vector<int> outer_;    // block row offsets
+    std::vector<int> inner_;    // block column indices
+    std::vector<Scalar> values_; // B*B column-major values per block
+
+    std::vector<int> t_outer_;  // block column offsets
+    std::vector<int> t_inner_;  // block row of each block in column order
+    std::vector<int> t_ids_;    // index of each block in column order
+  };
+
+}
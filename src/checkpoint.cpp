@@ -0,0 +1,102 @@
+#include "checkpoint.h"
+
+#include "precompute_cache.h"
+#include <iostream>
+
+using namespace mfem;
+using namespace Eigen;
+
+namespace {
+
+  // Bump when the layout of the checkpoint or of any component's arrays
+  // changes
+  constexpr int64_t CHECKPOINT_VERSION = 1;
+
+}
+
+bool Checkpoint::get(const std::string& name, MatrixXd& A) const {
+  auto it = arrays_.find(name);
+  if (it == arrays_.end()) {
+    return false;
+  }
+  A = it->second;
+  return true;
+}
+
+bool Checkpoint::get(const std::string& name, VectorXd& a) const {
+  auto it = arrays_.find(name);
+  if (it == arrays_.end()) {
+    return false;
+  }
+  a = it->second.reshaped();
+  return true;
+}
+
+bool mfem::write_checkpoint(const std::string& path, const Checkpoint& ckpt) {
+  CacheWriter writer(path, ckpt.key);
+  if (!writer.good()) {
+    return false;
+  }
+
+  int64_t header[3] = {CHECKPOINT_VERSION, ckpt.step,
+      int64_t(ckpt.arrays().size())};
+  writer.write(header, 3);
+  writer.write(&ckpt.time, 1);
+  for (const auto& [name, A] : ckpt.arrays()) {
+    writer.write(name.data(), name.size());
+    writer.write(A);
+  }
+  return writer.commit();
+}
+
+bool mfem::read_checkpoint(const std::string& path, uint64_t key,
+    Checkpoint& ckpt) {
+  CacheReader reader(path, key);
+  if (!reader.good()) {
+    return false;
+  }
+
+  uint64_t n;
+  const int64_t* header = reader.read<int64_t>(n);
+  if (header == nullptr || n != 3 || header[0] != CHECKPOINT_VERSION) {
+    return false;
+  }
+  const double* time = reader.read<double>(n);
+  if (time == nullptr || n != 1) {
+    return false;
+  }
+
+  Checkpoint out;
+  out.key = key;
+  out.step = header[1];
+  out.time = *time;
+  for (int64_t i = 0; i < header[2]; ++i) {
+    const char* name = reader.read<char>(n);
+    MatrixXd A;
+    if (name == nullptr || !reader.read(A)) {
+      return false;
+    }
+    out.set(std::string(name, n), A);
+  }
+  ckpt = std::move(out);
+  return true;
+}
+
+void CheckpointWriter::write(const std::string& path, Checkpoint&& ckpt) {
+  wait();
+  pending_ = std::async(std::launch::async,
+      [path, ckpt = std::move(ckpt)]() {
+        bool ok = write_checkpoint(path, ckpt);
+        if (!ok) {
+          std::cerr << "Failed to write checkpoint " << path << std::endl;
+        }
+        return ok;
+      });
+}
+
+bool CheckpointWriter::wait() {
+  if (!pending_.valid()) {
+    return true;
+  }
+  return pending_.get();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <string>
+
+namespace mfem {
+
+  // Simulation state needed to resume a run at a given step. Each part of
+  // the simulator (variables, integrator, boundary conditions) stores its
+  // state as named arrays, so components can add state without changing
+  // the file format.
+  class Checkpoint {
+  public:
+
+    int step = 0;     // number of completed timesteps
+    double time = 0;  // simulated time
+
+    // Identifies the simulation the state belongs to (e.g. a hash of the
+    // mesh). Restoring fails if the keys differ.
+    uint64_t key = 0;
+
+    void set(const std::string& name, const Eigen::MatrixXd& A) {
+      arrays_[name] = A;
+    }
+
+    // Returns false if there is no array with the given name
+    bool get(const std::string& name, Eigen::MatrixXd& A) const;
+    bool get(const std::string& name, Eigen::VectorXd& a) const;
+
+    bool contains(const std::string& name) const {
+      return arrays_.count(name) > 0;
+    }
+
+    const std::map<std::string, Eigen::MatrixXd>& arrays() const {
+      return arrays_;
+    }
+
+  private:
+    std::map<std::string, Eigen::MatrixXd> arrays_;
+  };
+
+  // Writes a checkpoint to a binary file. The file is written to a
+  // temporary and moved into place, so an interrupted write never leaves a
+  // truncated checkpoint behind.
+  bool write_checkpoint(const std::string& path, const Checkpoint& ckpt);
+
+  // Reads a checkpoint written by write_checkpoint() by memory-mapping the
+  // file. Returns false if the file is missing, was written by an
+  // incompatible version, or its key differs from key.
+  bool read_checkpoint(const std::string& path, uint64_t key,
+      Checkpoint& ckpt);
+
+  // Writes checkpoints on a background thread so the simulation doesn't
+  // wait on the file system. Only one write is in flight at a time; a new
+  // write first waits for the previous one.
+  class CheckpointWriter {
+  public:
+
+    ~CheckpointWriter() {
+      wait();
+    }
+
+    // Starts writing ckpt to path. The checkpoint is moved into the writer,
+    // so the caller can go on modifying the simulation.
+    void write(const std::string& path, Checkpoint&& ckpt);
+
+    // Blocks until the pending write finishes. Returns false if it failed.
+    bool wait();
+
+  private:
+    std::future<bool> pending_;
+  };
+
+}
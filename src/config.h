@@ -1,6 +1,7 @@
 #pragma once
 
 #include <EigenTypes.h>
+#include <string>
 
 namespace mfem {
 
@@ -40,6 +41,19 @@ namespace mfem {
     SOLVER_AFFINE_PCG
   };
 
+  // Floating point precision of the linear systems. Only the element
+  // hessian blocks, their assembly and the linear solves are affected;
+  // element evaluation (deformation gradients, rotations, material
+  // energies and derivatives), gradients and residuals stay in double.
+  enum SystemPrecisionType {
+    SYSTEM_DOUBLE, // everything in double precision
+    SYSTEM_MIXED,  // element hessian blocks formed and assembled in single
+                   // precision, linear solves in double
+    SYSTEM_SINGLE  // element hessian blocks, assembly and direct solves in
+                   // single precision. Solves are refined against the
+                   // double precision residual.
+  };
+
   enum MaterialModelType {
       MATERIAL_SNH,   // Stable neohookean
       MATERIAL_NH,    // neohookean
@@ -75,7 +89,15 @@ namespace mfem {
     double grav = -9.8;
     float ext[3] = {0., -9.8, 0.};
     double beta = 5.;
+
+    // Start each timestep from the integrator's extrapolated positions
+    // (with consistent stretches) instead of the last positions
     bool warm_start = false;
+
+    // Carry the Lagrange multipliers of the last timestep forward instead
+    // of zeroing them
+    bool warm_start_multipliers = false;
+
     bool floor_collision = false;
     bool regularizer = false;
     bool local_global = true;
@@ -95,12 +117,61 @@ namespace mfem {
     double newton_tol = 1e-10;
     double ls_tol = 1e-4;
     int ls_iters = 20;
+
+    // Evaluate several step lengths per pass over the elements in the line
+    // search (see linesearch_speculative)
+    bool ls_speculative = false;
     OptimizerType optimizer = OPTIMIZER_SQP_PD;
     int max_iterative_solver_iters = 500;
     double itr_tol = 1e-4;
+
+    // Inexact Newton: solve each Newton system with the iterative solver
+    // to an Eisenstat-Walker forcing term rather than to itr_tol, which
+    // becomes the floor on the tolerance (see ForcingTerm)
+    bool inexact_newton = false;
+    double inexact_eta_max = 0.5;
     BCScriptType bc_type = BC_ONEPOINT;
     SolverType solver_type = SOLVER_EIGEN_LLT;
+
+    // Store only the upper triangle of the symmetric system matrices
+    bool symmetric_storage = false;
+
+    // Assemble the system matrices as DIMxDIM blocks (see BSRMatrix).
+    // Iterative solvers (affine-pcg) run on the blocks, direct solvers
+    // are given the matrix expanded to scalar storage. Blocks store both
+    // triangles regardless of symmetric_storage. Double precision only.
+    bool block_storage = false;
+
+    // Apply the mixed Schur complement system matrix-free rather than
+    // assembling it. Only used with iterative solvers (affine-pcg).
+    bool matrix_free = false;
+
+    // Keep the factorization of direct solvers across Newton iterations
+    // and timesteps, using it to precondition CG on the current system.
+    // The system is refactorized once it drifts by more than
+    // lag_drift_tol (relative Frobenius norm) from the factorized one, or
+    // when CG needs more than lag_max_iters iterations (see LaggedSolver).
+    bool lagged_factorization = false;
+    double lag_drift_tol = 0.1;
+    int lag_max_iters = 20;
+
+    // Precision of the element hessian blocks, assembly and linear solves
+    SystemPrecisionType system_precision = SYSTEM_DOUBLE;
+
+    // Directory for caching mesh precomputation and solver orderings
+    // between runs. Empty disables the cache.
+    std::string cache_dir = "";
     TimeIntegratorType ti_type = TI_BDF1;
+
+    // Adaptive timestepping (see TimestepController). A step is rejected
+    // and retried with a smaller h if Newton does not reach newton_tol in
+    // outer_steps iterations or the local truncation error estimate of the
+    // positions exceeds lte_tol. Otherwise the next step is sized from the
+    // error estimate within [h_min, h_max]. h sets the initial step.
+    bool adaptive_timestep = false;
+    double h_min = 1e-4;
+    double h_max = 0.1;
+    double lte_tol = 1e-3;
   };
 
   // Simple config for material parameters for a single object
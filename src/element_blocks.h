@@ -0,0 +1,72 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include <type_traits>
+#include <vector>
+
+namespace mfem {
+
+  // Contiguous storage for per-element matrices (or vectors) that all have
+  // the same size. The size depends on the element type so it is only known
+  // at runtime, but kernels access each element through a fixed-size map so
+  // Eigen can unroll and vectorize the local products.
+  template <typename Scalar>
+  class ElementBlocks {
+  public:
+
+    // Set the number of elements and the size of each element's block.
+    // Values are left uninitialized.
+    void resize(int nelem, int rows, int cols = 1) {
+      nelem_ = nelem;
+      rows_ = rows;
+      cols_ = cols;
+      values_.resize(static_cast<size_t>(nelem) * rows * cols);
+    }
+
+    int size() const { return nelem_; }
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+
+    Scalar* data() { return values_.data(); }
+    const Scalar* data() const { return values_.data(); }
+
+    // Column-major block of the i-th element. R and C may be left dynamic
+    // for element types without a fixed-size kernel.
+    template <int R = Eigen::Dynamic, int C = Eigen::Dynamic>
+    Eigen::Map<Eigen::Matrix<Scalar, R, C>> block(int i) {
+      return Eigen::Map<Eigen::Matrix<Scalar, R, C>>(
+          values_.data() + static_cast<size_t>(i) * rows_ * cols_,
+          rows_, cols_);
+    }
+
+    template <int R = Eigen::Dynamic, int C = Eigen::Dynamic>
+    Eigen::Map<const Eigen::Matrix<Scalar, R, C>> block(int i) const {
+      return Eigen::Map<const Eigen::Matrix<Scalar, R, C>>(
+          values_.data() + static_cast<size_t>(i) * rows_ * cols_,
+          rows_, cols_);
+    }
+
+  private:
+    int nelem_ = 0;
+    int rows_ = 0;
+    int cols_ = 0;
+    std::vector<Scalar> values_;
+  };
+
+  // Calls func with a std::integral_constant holding the size of the
+  // element blocks (DIM * nodes) for the element types we have fixed-size
+  // kernels for, and Eigen::Dynamic for any other element type.
+  //   DIM == 3: tetrahedra (12) and triangles (9)
+  //   DIM == 2: triangles (6)
+  template <int DIM, typename Func>
+  void dispatch_element_size(int nodes, Func&& func) {
+    if (nodes == DIM + 1) {
+      func(std::integral_constant<int, DIM * (DIM + 1)>());
+    } else if (DIM == 3 && nodes == 3) {
+      func(std::integral_constant<int, 9>());
+    } else {
+      func(std::integral_constant<int, Eigen::Dynamic>());
+    }
+  }
+
+}
@@ -4,38 +4,94 @@
 using namespace Eigen;
 using namespace mfem;
 
+namespace {
+
+  // Element kernels shared by the per-element and batched evaluations. In
+  // and Out are fixed-size Eigen types or LaneRefs into a lane group.
+
+  template <typename In>
+  double energy6(const In& S, double mu, double la) {
+    double S1 = S(0);
+    double S2 = S(1);
+    double S3 = S(2);
+    double S4 = S(3);
+    double S5 = S(4);
+    double S6 = S(5);
+    return (mu*(pow(S1-1.0,2.0)+pow(S2-1.0,2.0)+pow(S3-1.0,2.0)+(S4*S4)*2.0
+          +(S5*S5)*2.0+(S6*S6)*2.0))/2.0;
+  }
+
+  template <typename In, typename Out>
+  void gradient6(const In& S, Out& g, double mu, double la) {
+    double S1 = S(0);
+    double S2 = S(1);
+    double S3 = S(2);
+    double S4 = S(3);
+    double S5 = S(4);
+    double S6 = S(5);
+    g(0) = (mu*(S1*2.0-2.0))/2.0;
+    g(1) = (mu*(S2*2.0-2.0))/2.0;
+    g(2) = (mu*(S3*2.0-2.0))/2.0;
+    g(3) = S4*mu*2.0;
+    g(4) = S5*mu*2.0;
+    g(5) = S6*mu*2.0;
+  }
+
+  template <typename In>
+  double energy3(const In& s, double mu, double la) {
+    double S1 = s(0);
+    double S2 = s(1);
+    double S3 = s(2);
+    return (mu*(pow(S1-1.0,2.0)+pow(S2-1.0,2.0)+(S3*S3)*2.0))/2.0;;
+  }
+
+  template <typename In, typename Out>
+  void gradient3(const In& s, Out& g, double mu, double la) {
+    double S1 = s(0);
+    double S2 = s(1);
+    double S3 = s(2);
+    g(0) = (mu*(S1*2.0-2.0))/2.0;
+    g(1) = (mu*(S2*2.0-2.0))/2.0;
+    g(2) = S3*mu*2.0;
+  }
+
+  template <typename In, typename Out>
+  void hessian3(const In& s, Out& H, double mu, double la) {
+    double S1 = s(0);
+    double S2 = s(1);
+    double S3 = s(2);
+    H.setZero();
+    H(0,0) = mu;
+    H(1,1) = mu;
+    H(2,2) = mu*2.0;
+  }
+}
+
 double ArapModel::energy(const Vector6d& S) {
-    
-  double mu = config_->mu;
-  double S1 = S(0);
-  double S2 = S(1);
-  double S3 = S(2);
-  double S4 = S(3);
-  double S5 = S(4);
-  double S6 = S(5);
-  return (mu*(pow(S1-1.0,2.0)+pow(S2-1.0,2.0)+pow(S3-1.0,2.0)+(S4*S4)*2.0
-        +(S5*S5)*2.0+(S6*S6)*2.0))/2.0;
+  return energy6(S, config_->mu, config_->la);
 }
 
-Vector6d ArapModel::gradient(const Vector6d& S) {
-  
+void ArapModel::energy(const LaneMatrix<double,6,1>& S, double* e) {
   double mu = config_->mu;
   double la = config_->la;
-  double S1 = S(0);
-  double S2 = S(1);
-  double S3 = S(2);
-  double S4 = S(3);
-  double S5 = S(4);
-  double S6 = S(5);
+  lane_apply(S, e, [=](const auto& S) {
+    return energy6(S, mu, la);
+  });
+}
+
+Vector6d ArapModel::gradient(const Vector6d& S) {
   Vector6d g;
-  g(0) = (mu*(S1*2.0-2.0))/2.0;
-  g(1) = (mu*(S2*2.0-2.0))/2.0;
-  g(2) = (mu*(S3*2.0-2.0))/2.0;
-  g(3) = S4*mu*2.0;
-  g(4) = S5*mu*2.0;
-  g(5) = S6*mu*2.0;
+  gradient6(S, g, config_->mu, config_->la);
   return g;
+}
 
+void ArapModel::gradient(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,1>& g) {
+  double mu = config_->mu;
+  double la = config_->la;
+  lane_apply(S, g, [=](const auto& S, auto& g) {
+    gradient6(S, g, mu, la);
+  });
 }
 
 Matrix6d ArapModel::hessian_inv(const Vector6d& S) {
@@ -64,35 +120,53 @@ Matrix6d ArapModel::hessian(const Vector6d& S, bool psd_fix) {
   return tmp.asDiagonal() * mu;
 }
 
+void ArapModel::hessian(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,6>& H, bool psd_fix) {
+  // Hessian is constant
+  Matrix6d H0 = ArapModel::hessian(Vector6d::Zero(), psd_fix);
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    H.set(l, H0);
+  }
+}
+
 double ArapModel::energy(const Vector3d& s) {
+  return energy3(s, config_->mu, config_->la);
+}
+
+void ArapModel::energy(const LaneMatrix<double,3,1>& s, double* e) {
   double mu = config_->mu;
-  double S1 = s(0);
-  double S2 = s(1);
-  double S3 = s(2);
-  return (mu*(pow(S1-1.0,2.0)+pow(S2-1.0,2.0)+(S3*S3)*2.0))/2.0;;
+  double la = config_->la;
+  lane_apply(s, e, [=](const auto& s) {
+    return energy3(s, mu, la);
+  });
 }
 
 Vector3d ArapModel::gradient(const Vector3d& s) {
-  double mu = config_->mu;
-  double S1 = s(0);
-  double S2 = s(1);
-  double S3 = s(2);
   Vector3d g;
-  g(0) = (mu*(S1*2.0-2.0))/2.0;
-  g(1) = (mu*(S2*2.0-2.0))/2.0;
-  g(2) = S3*mu*2.0;
+  gradient3(s, g, config_->mu, config_->la);
   return g;
 }
 
-Matrix3d ArapModel::hessian(const Vector3d& s) {
+void ArapModel::gradient(const LaneMatrix<double,3,1>& s,
+    LaneMatrix<double,3,1>& g) {
   double mu = config_->mu;
-  double S1 = s(0);
-  double S2 = s(1);
-  double S3 = s(2);
+  double la = config_->la;
+  lane_apply(s, g, [=](const auto& s, auto& g) {
+    gradient3(s, g, mu, la);
+  });
+}
+
+Matrix3d ArapModel::hessian(const Vector3d& s) {
   Matrix3d H;
-  H.setZero();
-  H(0,0) = mu;
-  H(1,1) = mu;
-  H(2,2) = mu*2.0;
+  hessian3(s, H, config_->mu, config_->la);
   return H;
 }
+
+void ArapModel::hessian(const LaneMatrix<double,3,1>& s,
+    LaneMatrix<double,3,3>& H) {
+  double mu = config_->mu;
+  double la = config_->la;
+  lane_apply(s, H, [=](const auto& s, auto& H) {
+    hessian3(s, H, mu, la);
+  });
+}
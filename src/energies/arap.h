@@ -26,9 +26,21 @@ namespace mfem {
     Eigen::Matrix6d hessian(const Eigen::Vector6d& S,
         bool psd_fix = true) override;
 
+    void energy(const LaneMatrix<double,6,1>& S, double* e) override;
+    void gradient(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,1>& g) override;
+    void hessian(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,6>& H, bool psd_fix = true) override;
+
     double energy(const Eigen::Vector3d& s) override;
     Eigen::Vector3d gradient(const Eigen::Vector3d& s) override;
     Eigen::Matrix3d hessian(const Eigen::Vector3d& s) override;    
+
+    void energy(const LaneMatrix<double,3,1>& s, double* e) override;
+    void gradient(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,1>& g) override;
+    void hessian(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,3>& H) override;
   };
 
 
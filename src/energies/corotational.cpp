@@ -5,38 +5,81 @@
 using namespace Eigen;
 using namespace mfem;
 
+namespace {
+
+  // Element kernels shared by the per-element and batched evaluations. In
+  // and Out are fixed-size Eigen types or LaneRefs into a lane group.
+
+  template <typename In>
+  double energy6(const In& S, double mu, double la) {
+    double S1 = S(0);
+    double S2 = S(1);
+    double S3 = S(2);
+    double S4 = S(3);
+    double S5 = S(4);
+    double S6 = S(5);
+    return 0.5*la*(S1+S2+S3-3.0)*(S1+S2+S3-3.0)+mu*((S1-1.0)*(S1-1.0)+(S2-1.0)*(S2-1.0)+(S3-1.0)*(S3-1.0)+(S4*S4)*2.0+(S5*S5)*2.0+(S6*S6)*2.0);
+  }
+
+  template <typename In, typename Out>
+  void gradient6(const In& S, Out& g, double mu, double la) {
+    double S1 = S(0);
+    double S2 = S(1);
+    double S3 = S(2);
+    double S4 = S(3);
+    double S5 = S(4);
+    double S6 = S(5);
+    g(0) = (la*(S1+S2+S3-3.0))+mu*(S1*2.0-2.0);
+    g(1) = (la*(S1+S2+S3-3.0))+mu*(S2*2.0-2.0);
+    g(2) = (la*(S1+S2+S3-3.0))+mu*(S3*2.0-2.0);
+    g(3) = S4*mu*4.0;
+    g(4) = S5*mu*4.0;
+    g(5) = S6*mu*4.0;
+  }
+
+  template <typename In, typename Out>
+  void hessian6(const In& S, Out& H, double mu, double la) {
+    H.setZero();
+    H(0,0) = la+mu*2.0;
+    H(0,1) = la;
+    H(0,2) = la;
+    H(1,0) = la;
+    H(1,1) = la+mu*2.0;
+    H(1,2) = la;
+    H(2,0) = la;
+    H(2,1) = la;
+    H(2,2) = la+mu*2.0;
+    H(3,3) = mu*4.0;
+    H(4,4) = mu*4.0;
+    H(5,5) = mu*4.0;
+  }
+}
+
 double Corotational::energy(const Vector6d& S) {
-    
+  return energy6(S, config_->mu, config_->la);
+}
+
+void Corotational::energy(const LaneMatrix<double,6,1>& S, double* e) {
   double mu = config_->mu;
   double la = config_->la;
-  double S1 = S(0);
-  double S2 = S(1);
-  double S3 = S(2);
-  double S4 = S(3);
-  double S5 = S(4);
-  double S6 = S(5);
-  return 0.5*la*(S1+S2+S3-3.0)*(S1+S2+S3-3.0)+mu*((S1-1.0)*(S1-1.0)+(S2-1.0)*(S2-1.0)+(S3-1.0)*(S3-1.0)+(S4*S4)*2.0+(S5*S5)*2.0+(S6*S6)*2.0);
+  lane_apply(S, e, [=](const auto& S) {
+    return energy6(S, mu, la);
+  });
 }
 
 Vector6d Corotational::gradient(const Vector6d& S) {
-  
-  double mu = config_->mu;
-  double la = config_->la;
-  double S1 = S(0);
-  double S2 = S(1);
-  double S3 = S(2);
-  double S4 = S(3);
-  double S5 = S(4);
-  double S6 = S(5);
   Vector6d g;
-  g(0) = (la*(S1+S2+S3-3.0))+mu*(S1*2.0-2.0);
-  g(1) = (la*(S1+S2+S3-3.0))+mu*(S2*2.0-2.0);
-  g(2) = (la*(S1+S2+S3-3.0))+mu*(S3*2.0-2.0);
-  g(3) = S4*mu*4.0;
-  g(4) = S5*mu*4.0;
-  g(5) = S6*mu*4.0;
+  gradient6(S, g, config_->mu, config_->la);
   return g;
+}
 
+void Corotational::gradient(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,1>& g) {
+  double mu = config_->mu;
+  double la = config_->la;
+  lane_apply(S, g, [=](const auto& S, auto& g) {
+    gradient6(S, g, mu, la);
+  });
 }
 
 Matrix6d Corotational::hessian_inv(const Vector6d& S) {
@@ -69,20 +112,15 @@ Matrix6d Corotational::hessian_inv(const Vector6d& S) {
 
 Matrix6d Corotational::hessian(const Vector6d& S, bool psd_fix) {
   Matrix6d H;
-  H.setZero();
+  hessian6(S, H, config_->mu, config_->la);
+  return H;
+}
+
+void Corotational::hessian(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,6>& H, bool psd_fix) {
   double mu = config_->mu;
   double la = config_->la;
-  H(0,0) = la+mu*2.0;
-  H(0,1) = la;
-  H(0,2) = la;
-  H(1,0) = la;
-  H(1,1) = la+mu*2.0;
-  H(1,2) = la;
-  H(2,0) = la;
-  H(2,1) = la;
-  H(2,2) = la+mu*2.0;
-  H(3,3) = mu*4.0;
-  H(4,4) = mu*4.0;
-  H(5,5) = mu*4.0;
-  return H;
+  lane_apply(S, H, [=](const auto& S, auto& H) {
+    hessian6(S, H, mu, la);
+  });
 }
@@ -23,6 +23,12 @@ namespace mfem {
 
     Eigen::Matrix6d hessian(const Eigen::Vector6d& S,
         bool psd_fix = true) override;
+
+    void energy(const LaneMatrix<double,6,1>& S, double* e) override;
+    void gradient(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,1>& g) override;
+    void hessian(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,6>& H, bool psd_fix = true) override;
   };
 
 
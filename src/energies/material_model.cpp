@@ -1 +1,105 @@
-#include "energies/material_model.h"
\ No newline at end of file
+#include "energies/material_model.h"
+#include "simple_psd_fix.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // Fallbacks for models without batched kernels. These go through the
+  // virtual per-element methods one lane at a time.
+
+  template <int N>
+  void energy_lanes(MaterialModel& model, const LaneMatrix<double,N,1>& S,
+      double* e) {
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      e[l] = model.energy(Vector<double,N>(S.get(l)));
+    }
+  }
+
+  template <int N>
+  void gradient_lanes(MaterialModel& model, const LaneMatrix<double,N,1>& S,
+      LaneMatrix<double,N,1>& g) {
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      g.set(l, model.gradient(Vector<double,N>(S.get(l))));
+    }
+  }
+
+  template <int N, typename... Args>
+  void hessian_lanes(MaterialModel& model, const LaneMatrix<double,N,1>& S,
+      LaneMatrix<double,N,N>& H, Args... args) {
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      H.set(l, model.hessian(Vector<double,N>(S.get(l)), args...));
+    }
+  }
+}
+
+void MaterialModel::energy(const LaneMatrix<double,6,1>& S, double* e) {
+  energy_lanes(*this, S, e);
+}
+
+void MaterialModel::gradient(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,1>& g) {
+  gradient_lanes(*this, S, g);
+}
+
+void MaterialModel::hessian(const LaneMatrix<double,6,1>& S,
+    LaneMatrix<double,6,6>& H, bool psd_fix) {
+  hessian_lanes(*this, S, H, psd_fix);
+}
+
+void MaterialModel::energy(const LaneMatrix<double,9,1>& F, double* e) {
+  energy_lanes(*this, F, e);
+}
+
+void MaterialModel::gradient(const LaneMatrix<double,9,1>& F,
+    LaneMatrix<double,9,1>& g) {
+  gradient_lanes(*this, F, g);
+}
+
+void MaterialModel::hessian(const LaneMatrix<double,9,1>& F,
+    LaneMatrix<double,9,9>& H) {
+  hessian_lanes(*this, F, H);
+}
+
+void MaterialModel::energy(const LaneMatrix<double,3,1>& s, double* e) {
+  energy_lanes(*this, s, e);
+}
+
+void MaterialModel::gradient(const LaneMatrix<double,3,1>& s,
+    LaneMatrix<double,3,1>& g) {
+  gradient_lanes(*this, s, g);
+}
+
+void MaterialModel::hessian(const LaneMatrix<double,3,1>& s,
+    LaneMatrix<double,3,3>& H) {
+  hessian_lanes(*this, s, H);
+}
+
+void MaterialModel::energy(const LaneMatrix<double,4,1>& F, double* e) {
+  energy_lanes(*this, F, e);
+}
+
+void MaterialModel::gradient(const LaneMatrix<double,4,1>& F,
+    LaneMatrix<double,4,1>& g) {
+  gradient_lanes(*this, F, g);
+}
+
+void MaterialModel::hessian(const LaneMatrix<double,4,1>& F,
+    LaneMatrix<double,4,4>& H) {
+  hessian_lanes(*this, F, H);
+}
+
+template <int N>
+void MaterialModel::psd_fix(LaneMatrix<double,N,N>& H) {
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    Matrix<double,N,N> Hl = H.get(l);
+    sim::simple_psd_fix(Hl);
+    H.set(l, Hl);
+  }
+}
+
+template void MaterialModel::psd_fix(LaneMatrix<double,3,3>&);
+template void MaterialModel::psd_fix(LaneMatrix<double,4,4>&);
+template void MaterialModel::psd_fix(LaneMatrix<double,6,6>&);
+template void MaterialModel::psd_fix(LaneMatrix<double,9,9>&);
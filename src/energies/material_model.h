@@ -3,6 +3,7 @@
 #include <EigenTypes.h>
 #include <string>
 #include <memory>
+#include "batch_matrix.h"
 
 namespace mfem {
 
@@ -116,8 +117,56 @@ namespace mfem {
       return H;
     }
 
+    // Batched evaluations over a lane group of BATCH_WIDTH elements. Each
+    // group costs a single virtual call. The defaults here loop over the
+    // per-element methods above; the models override them with their
+    // element kernels applied across the lanes, which vectorizes.
+    // Every lane is evaluated, so padding lanes should hold a valid
+    // deformation (e.g. the identity) rather than zeros.
+
+    // Energy densities of the group.
+    // S - 6x1 symmetric deformations
+    // e - BATCH_WIDTH energy densities
+    virtual void energy(const LaneMatrix<double,6,1>& S, double* e);
+
+    // Gradients with respect to symmetric deformations, S
+    virtual void gradient(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,1>& g);
+
+    // Hessians with respect to symmetric deformations, S
+    virtual void hessian(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,6>& H, bool psd_fix = true);
+
+    // Non-mixed batched evaluations
+    // F - 9x1 deformation gradients flattened (column-major)
+    virtual void energy(const LaneMatrix<double,9,1>& F, double* e);
+    virtual void gradient(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,1>& g);
+    virtual void hessian(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,9>& H);
+
+    // Mixed batched evaluations for 2D and shells
+    // s - 3x1 symmetric deformations
+    virtual void energy(const LaneMatrix<double,3,1>& s, double* e);
+    virtual void gradient(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,1>& g);
+    virtual void hessian(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,3>& H);
+
+    // Non-mixed batched evaluations for 2D
+    // F - 4x1 deformation gradients flattened (column-major)
+    virtual void energy(const LaneMatrix<double,4,1>& F, double* e);
+    virtual void gradient(const LaneMatrix<double,4,1>& F,
+        LaneMatrix<double,4,1>& g);
+    virtual void hessian(const LaneMatrix<double,4,1>& F,
+        LaneMatrix<double,4,4>& H);
+
   protected:
 
+    // Projects each lane's hessian onto the positive semi-definite cone
+    template <int N>
+    static void psd_fix(LaneMatrix<double,N,N>& H);
+
     std::shared_ptr<MaterialConfig> config_;     
 
   };
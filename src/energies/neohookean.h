@@ -20,9 +20,21 @@ namespace mfem {
     Eigen::Matrix6d hessian(const Eigen::Vector6d& S,
         bool psd_fix = true) override;
 
+    void energy(const LaneMatrix<double,6,1>& S, double* e) override;
+    void gradient(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,1>& g) override;
+    void hessian(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,6>& H, bool psd_fix = true) override;
+
     double energy(const Eigen::Vector9d& F) override;
     Eigen::Vector9d gradient(const Eigen::Vector9d& F) override;
     Eigen::Matrix9d hessian(const Eigen::Vector9d& F) override;
+
+    void energy(const LaneMatrix<double,9,1>& F, double* e) override;
+    void gradient(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,1>& g) override;
+    void hessian(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,9>& H) override;
   };
 
 }
@@ -22,16 +22,40 @@ namespace mfem {
     Eigen::Matrix6d hessian(const Eigen::Vector6d& S,
         bool psd_fix = true) override;
 
+    void energy(const LaneMatrix<double,6,1>& S, double* e) override;
+    void gradient(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,1>& g) override;
+    void hessian(const LaneMatrix<double,6,1>& S,
+        LaneMatrix<double,6,6>& H, bool psd_fix = true) override;
+
     double energy(const Eigen::Vector9d& F) override;
     Eigen::Vector9d gradient(const Eigen::Vector9d& F) override;
     Eigen::Matrix9d hessian(const Eigen::Vector9d& F) override;
 
+    void energy(const LaneMatrix<double,9,1>& F, double* e) override;
+    void gradient(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,1>& g) override;
+    void hessian(const LaneMatrix<double,9,1>& F,
+        LaneMatrix<double,9,9>& H) override;
+
     double energy(const Eigen::Vector3d& s) override;
     Eigen::Vector3d gradient(const Eigen::Vector3d& s) override;
     Eigen::Matrix3d hessian(const Eigen::Vector3d& s) override;
 
+    void energy(const LaneMatrix<double,3,1>& s, double* e) override;
+    void gradient(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,1>& g) override;
+    void hessian(const LaneMatrix<double,3,1>& s,
+        LaneMatrix<double,3,3>& H) override;
+
     double energy(const Eigen::Vector4d& F) override;
     Eigen::Vector4d gradient(const Eigen::Vector4d& F) override;
     Eigen::Matrix4d hessian(const Eigen::Vector4d& F) override;
+
+    void energy(const LaneMatrix<double,4,1>& F, double* e) override;
+    void gradient(const LaneMatrix<double,4,1>& F,
+        LaneMatrix<double,4,1>& g) override;
+    void hessian(const LaneMatrix<double,4,1>& F,
+        LaneMatrix<double,4,4>& H) override;
   };
 }
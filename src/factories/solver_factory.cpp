@@ -3,6 +3,9 @@
 #include "EigenTypes.h"
 #include "linear_solvers/eigen_solver.h"
 #include "linear_solvers/affine_pcg.h"
+#include "linear_solvers/cached_ordering.h"
+#include "linear_solvers/single_precision_solver.h"
+#include "linear_solvers/lagged_solver.h"
 
 #if defined(SIM_USE_CHOLMOD)
 #include <Eigen/CholmodSupport>
@@ -13,35 +16,98 @@ using namespace Eigen;
 
 using Scalar = double;
 
+namespace {
+
+  // Simplicial solvers reuse fill-reducing orderings for repeated patterns
+  using Ordering = CachedAMDOrdering<int>;
+
+  template <typename T, int UpLo>
+  using LLTSolver = SimplicialLLT<SparseMatrix<T, RowMajor>, UpLo, Ordering>;
+
+  template <typename T, int UpLo>
+  using LDLTSolver = SimplicialLDLT<SparseMatrix<T, RowMajor>, UpLo, Ordering>;
+
+  template <typename T, int UpLo>
+  using LUSolver = SparseLU<SparseMatrix<T, RowMajor>>;
+
+  // Creates an Eigen direct solver in precision T.
+  // The Cholesky solvers only read one triangle. With symmetric storage
+  // they are instantiated to read the upper triangle that is assembled.
+  // Solvers that read the full matrix (LU) instead expand upper triangular
+  // inputs.
+  template <template <typename, int> class SolverT, typename T,
+      bool full = false>
+  std::unique_ptr<LinearSolver<T, RowMajor>> create_eigen_solver(
+      bool upper) {
+    if (upper && !full) {
+      using Solver = mfem::EigenSolver<SolverT<T, Upper>, T, RowMajor>;
+      return std::make_unique<Solver>();
+    }
+    using Solver = mfem::EigenSolver<SolverT<T, Lower>, T, RowMajor>;
+    return std::make_unique<Solver>(upper && full);
+  }
+
+  // Wraps a direct solver to reuse its factorization if enabled
+  std::unique_ptr<LinearSolver<Scalar, RowMajor>> lagged(
+      std::unique_ptr<LinearSolver<Scalar, RowMajor>> solver,
+      const SimConfig& config) {
+    if (!config.lagged_factorization) {
+      return solver;
+    }
+    return std::make_unique<LaggedSolver<RowMajor>>(std::move(solver),
+        config.symmetric_storage, config.lag_drift_tol, config.lag_max_iters,
+        config.itr_tol);
+  }
+
+  // In single precision mode the factorization runs in float behind a
+  // double precision interface.
+  template <template <typename, int> class SolverT, bool full = false>
+  std::unique_ptr<LinearSolver<Scalar, RowMajor>> create_eigen_solver(
+      const SimConfig& config) {
+    bool upper = config.symmetric_storage;
+    if (config.system_precision == SYSTEM_SINGLE) {
+      return lagged(std::make_unique<SinglePrecisionSolver<RowMajor>>(
+          create_eigen_solver<SolverT, float, full>(upper), upper), config);
+    }
+    return lagged(create_eigen_solver<SolverT, Scalar, full>(upper), config);
+  }
+}
+
 SolverFactory::SolverFactory() {
 
   // Eigen LLT
-  using LLT = SimplicialLLT<SparseMatrix<Scalar, RowMajor>>;
   register_type(SolverType::SOLVER_EIGEN_LLT, "eigen-llt",
       [](std::shared_ptr<Mesh> mesh, std::shared_ptr<SimConfig> config)
       ->std::unique_ptr<LinearSolver<Scalar, RowMajor>>
-      {return std::make_unique<EigenSolver<LLT, Scalar, RowMajor>>();});
+      {return create_eigen_solver<LLTSolver>(*config);});
 
   // Eigen LDLT
-  using LDLT = SimplicialLDLT<SparseMatrix<Scalar, RowMajor>>;
   register_type(SolverType::SOLVER_EIGEN_LDLT, "eigen-ldlt",
       [](std::shared_ptr<Mesh> mesh, std::shared_ptr<SimConfig> config)
       ->std::unique_ptr<LinearSolver<Scalar, RowMajor>>
-      {return std::make_unique<EigenSolver<LDLT, Scalar, RowMajor>>();});
+      {return create_eigen_solver<LDLTSolver>(*config);});
 
   // Eigen LU
-  using LU = SparseLU<SparseMatrix<Scalar, RowMajor>>;
   register_type(SolverType::SOLVER_EIGEN_LU, "eigen-lu",
       [](std::shared_ptr<Mesh> mesh, std::shared_ptr<SimConfig> config)
       ->std::unique_ptr<LinearSolver<Scalar, RowMajor>>
-      {return std::make_unique<EigenSolver<LU, Scalar, RowMajor>>();});
+      {return create_eigen_solver<LUSolver, true>(*config);});
 
+  // CHOLMOD and the iterative solvers only support double precision
   #if defined(SIM_USE_CHOLMOD)
   using CHOLMOD = CholmodSupernodalLLT<SparseMatrix<Scalar, RowMajor>>;
+  using CHOLMODUpper = CholmodSupernodalLLT<SparseMatrix<Scalar, RowMajor>,
+      Upper>;
   register_type(SolverType::SOLVER_CHOLMOD, "cholmod",
       [](std::shared_ptr<Mesh> mesh, std::shared_ptr<SimConfig> config)
-      ->std::unique_ptr<LinearSolver<Scalar, RowMajor>>
-      {return std::make_unique<EigenSolver<CHOLMOD, Scalar, RowMajor>>();});
+      ->std::unique_ptr<LinearSolver<Scalar, RowMajor>> {
+        if (config->symmetric_storage) {
+          return lagged(std::make_unique<EigenSolver<CHOLMODUpper, Scalar,
+              RowMajor>>(), *config);
+        }
+        return lagged(std::make_unique<EigenSolver<CHOLMOD, Scalar,
+            RowMajor>>(), *config);
+      });
   #endif
 
   // Affine Body Dynamics initialized PCG with ARAP preconditioner
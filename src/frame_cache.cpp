@@ -0,0 +1,418 @@
+#include "frame_cache.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace mfem;
+using namespace Eigen;
+
+namespace {
+
+  // Bump when the layout of the header or frame records changes
+  constexpr uint32_t FRAME_CACHE_VERSION = 2;
+  constexpr char FRAME_CACHE_MAGIC[8] = {'M','F','E','M','F','R','M','S'};
+
+  struct FrameCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t encoding;
+    uint32_t dim;
+    uint32_t element_size;  // vertices per element
+    uint64_t vertices;
+    uint64_t elements;
+    double quantum;
+    uint32_t keyframe_interval;
+    uint32_t padding;
+  };
+
+  // Precedes the encoded positions of each frame
+  struct FrameRecord {
+    uint32_t keyframe;
+    uint32_t padding;
+    int64_t step;
+    double time;
+    uint64_t bytes;         // size of the encoded positions
+  };
+
+  // Records are padded to keep every record 8 byte aligned
+  size_t padding(size_t bytes) {
+    return (8 - bytes % 8) % 8;
+  }
+
+  // Zigzag encoded variable length integers. Small magnitudes of either
+  // sign take few bytes.
+  void put_varint(std::vector<uint8_t>& out, int64_t v) {
+    uint64_t z = (uint64_t(v) << 1) ^ uint64_t(v >> 63);
+    while (z >= 0x80) {
+      out.push_back(uint8_t(z) | 0x80);
+      z >>= 7;
+    }
+    out.push_back(uint8_t(z));
+  }
+
+  bool get_varint(const uint8_t*& p, const uint8_t* end, int64_t& v) {
+    uint64_t z = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+      uint8_t b = *p++;
+      z |= uint64_t(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        v = int64_t(z >> 1) ^ -int64_t(z & 1);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename T>
+  void put(std::vector<uint8_t>& out, T value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+  }
+}
+
+FrameCacheWriter::FrameCacheWriter(const std::string& path,
+    const MatrixXd& V0, const MatrixXi& T, const FrameCacheOptions& options)
+    : options_(options), vertices_(V0.rows()), dim_(V0.cols()),
+      failed_(false) {
+  options_.keyframe_interval = std::max(options_.keyframe_interval, 1);
+  options_.max_pending = std::max(options_.max_pending, 1);
+
+  file_ = fopen(path.c_str(), "wb");
+  if (file_ == nullptr) {
+    failed_ = true;
+    return;
+  }
+
+  FrameCacheHeader header;
+  std::memcpy(header.magic, FRAME_CACHE_MAGIC, sizeof(FRAME_CACHE_MAGIC));
+  header.version = FRAME_CACHE_VERSION;
+  header.encoding = options_.encoding;
+  header.dim = dim_;
+  header.element_size = T.cols();
+  header.vertices = vertices_;
+  header.elements = T.rows();
+  header.quantum = options_.quantum;
+  header.keyframe_interval = options_.keyframe_interval;
+  header.padding = 0;
+  write_bytes(&header, sizeof(header));
+
+  // Topology in row major order
+  Matrix<int32_t, Dynamic, Dynamic, RowMajor> Tr = T.cast<int32_t>();
+  size_t bytes = sizeof(int32_t) * Tr.size();
+  write_bytes(Tr.data(), bytes);
+  static const char zeros[8] = {0};
+  write_bytes(zeros, padding(bytes));
+
+  // Rest positions in row major order
+  Matrix<double, Dynamic, Dynamic, RowMajor> V0r = V0;
+  write_bytes(V0r.data(), sizeof(double) * V0r.size());
+  fflush(file_);
+
+  thread_ = std::thread(&FrameCacheWriter::run, this);
+}
+
+FrameCacheWriter::~FrameCacheWriter() {
+  close();
+}
+
+void FrameCacheWriter::write(int step, double time, const MatrixXd& V) {
+  if (failed_) {
+    return;
+  }
+  assert(V.rows() == vertices_ && V.cols() == dim_);
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&]() {
+      return int(queue_.size()) < options_.max_pending;
+    });
+    queue_.push_back({step, time, V});
+  }
+  cv_.notify_all();
+}
+
+bool FrameCacheWriter::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closing_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  if (file_ != nullptr) {
+    if (fclose(file_) != 0) {
+      failed_ = true;
+    }
+    file_ = nullptr;
+  }
+  return good();
+}
+
+void FrameCacheWriter::run() {
+  while (true) {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&]() { return !queue_.empty() || closing_; });
+      if (queue_.empty()) {
+        return;
+      }
+      frame = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    cv_.notify_all();
+    write_frame(frame);
+  }
+}
+
+void FrameCacheWriter::write_frame(const Frame& frame) {
+  const MatrixXd& V = frame.V;
+  int n = vertices_ * dim_;
+  payload_.clear();
+
+  FrameRecord record;
+  record.keyframe = 1;
+  switch (options_.encoding) {
+    case FRAME_DOUBLE:
+      for (int i = 0; i < vertices_; ++i) {
+        for (int j = 0; j < dim_; ++j) {
+          put(payload_, V(i,j));
+        }
+      }
+      break;
+    case FRAME_FLOAT:
+      for (int i = 0; i < vertices_; ++i) {
+        for (int j = 0; j < dim_; ++j) {
+          put(payload_, float(V(i,j)));
+        }
+      }
+      break;
+    case FRAME_QUANTIZED: {
+      record.keyframe = frames_ % options_.keyframe_interval == 0;
+      q_.resize(n, 0);
+      for (int i = 0; i < vertices_; ++i) {
+        for (int j = 0; j < dim_; ++j) {
+          int64_t q = std::llround(V(i,j) / options_.quantum);
+          int64_t& prev = q_[i*dim_ + j];
+          put_varint(payload_, record.keyframe ? q : q - prev);
+          prev = q;
+        }
+      }
+      break;
+    }
+  }
+
+  record.padding = 0;
+  record.step = frame.step;
+  record.time = frame.time;
+  record.bytes = payload_.size();
+  static const char zeros[8] = {0};
+  write_bytes(&record, sizeof(record));
+  write_bytes(payload_.data(), payload_.size());
+  write_bytes(zeros, padding(payload_.size()));
+
+  // Frames become visible to readers as they are recorded
+  if (file_ != nullptr) {
+    fflush(file_);
+  }
+  ++frames_;
+}
+
+void FrameCacheWriter::write_bytes(const void* data, size_t bytes) {
+  if (file_ == nullptr || failed_) {
+    return;
+  }
+  if (fwrite(data, 1, bytes, file_) != bytes) {
+    failed_ = true;
+  }
+}
+
+FrameCacheReader::FrameCacheReader(const std::string& path)
+    : path_(path) {
+  map();
+}
+
+FrameCacheReader::~FrameCacheReader() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+bool FrameCacheReader::map() {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  // Frames are appended, so the new mapping covers the old one
+  const char* data = nullptr;
+  size_t size = 0;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(FrameCacheHeader)) {
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr != MAP_FAILED) {
+      data = static_cast<const char*>(ptr);
+      size = st.st_size;
+    }
+  }
+  close(fd);
+
+  if (data == nullptr || size < size_) {
+    if (data != nullptr) {
+      munmap(const_cast<char*>(data), size);
+    }
+    return false;
+  }
+
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+  data_ = data;
+  size_ = size;
+
+  // Header, topology and rest positions on the first mapping
+  if (end_ == 0) {
+    const FrameCacheHeader* header =
+        reinterpret_cast<const FrameCacheHeader*>(data_);
+    size_t T_bytes = sizeof(int32_t) * header->elements
+        * header->element_size;
+    size_t V0_bytes = sizeof(double) * header->vertices * header->dim;
+    size_t begin = sizeof(FrameCacheHeader) + T_bytes + padding(T_bytes)
+        + V0_bytes;
+    if (std::memcmp(header->magic, FRAME_CACHE_MAGIC,
+            sizeof(FRAME_CACHE_MAGIC)) != 0
+        || header->version != FRAME_CACHE_VERSION
+        || header->encoding > FRAME_QUANTIZED
+        || begin > size_) {
+      munmap(const_cast<char*>(data_), size_);
+      data_ = nullptr;
+      size_ = 0;
+      return false;
+    }
+    options_.encoding = static_cast<FrameEncoding>(header->encoding);
+    options_.quantum = header->quantum;
+    options_.keyframe_interval = header->keyframe_interval;
+
+    const char* p = data_ + sizeof(FrameCacheHeader);
+    T_ = Map<const Matrix<int32_t, Dynamic, Dynamic, RowMajor>>(
+        reinterpret_cast<const int32_t*>(p), header->elements,
+        header->element_size).cast<int>();
+    p += T_bytes + padding(T_bytes);
+    V0_ = Map<const Matrix<double, Dynamic, Dynamic, RowMajor>>(
+        reinterpret_cast<const double*>(p), header->vertices, header->dim);
+    end_ = begin;
+  }
+
+  // Index the complete frames past the last indexed one
+  while (end_ + sizeof(FrameRecord) <= size_) {
+    const FrameRecord* record =
+        reinterpret_cast<const FrameRecord*>(data_ + end_);
+    size_t bytes = sizeof(FrameRecord) + record->bytes
+        + padding(record->bytes);
+    if (record->bytes > size_ - end_ - sizeof(FrameRecord)
+        || bytes > size_ - end_) {
+      break;
+    }
+    int keyframe = record->keyframe ? int(index_.size())
+        : (keyframes_.empty() ? -1 : keyframes_.back());
+    index_.push_back(end_);
+    keyframes_.push_back(keyframe);
+    end_ += bytes;
+  }
+  return true;
+}
+
+int FrameCacheReader::refresh() {
+  map();
+  return frames();
+}
+
+int FrameCacheReader::step(int i) const {
+  assert(i >= 0 && i < frames());
+  return reinterpret_cast<const FrameRecord*>(data_ + index_[i])->step;
+}
+
+double FrameCacheReader::time(int i) const {
+  assert(i >= 0 && i < frames());
+  return reinterpret_cast<const FrameRecord*>(data_ + index_[i])->time;
+}
+
+bool FrameCacheReader::read(int i, Frame& frame) {
+  if (i < 0 || i >= frames() || !decode(i, frame.V)) {
+    return false;
+  }
+  frame.step = step(i);
+  frame.time = time(i);
+  current_ = i;
+  return true;
+}
+
+bool FrameCacheReader::decode(int i, MatrixXd& V) {
+  int vertices = V0_.rows();
+  int dim = V0_.cols();
+  int n = vertices * dim;
+  V.resize(vertices, dim);
+
+  if (options_.encoding != FRAME_QUANTIZED) {
+    const FrameRecord* record =
+        reinterpret_cast<const FrameRecord*>(data_ + index_[i]);
+    const char* p = data_ + index_[i] + sizeof(FrameRecord);
+    size_t size = options_.encoding == FRAME_DOUBLE
+        ? sizeof(double) : sizeof(float);
+    if (record->bytes != size * n) {
+      return false;
+    }
+    for (int j = 0; j < vertices; ++j) {
+      for (int k = 0; k < dim; ++k, p += size) {
+        if (options_.encoding == FRAME_DOUBLE) {
+          double x;
+          std::memcpy(&x, p, sizeof(x));
+          V(j,k) = x;
+        } else {
+          float x;
+          std::memcpy(&x, p, sizeof(x));
+          V(j,k) = x;
+        }
+      }
+    }
+    return true;
+  }
+
+  // Deltas are applied from the keyframe, unless the positions decoded
+  // last are on the way
+  int start = keyframes_[i];
+  if (start < 0) {
+    return false;
+  }
+  if (decoded_ >= start && decoded_ <= i) {
+    start = decoded_ + 1;
+  }
+  q_.resize(n, 0);
+  for (int f = start; f <= i; ++f) {
+    const FrameRecord* record =
+        reinterpret_cast<const FrameRecord*>(data_ + index_[f]);
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(record + 1);
+    const uint8_t* end = p + record->bytes;
+    for (int j = 0; j < n; ++j) {
+      int64_t v;
+      if (!get_varint(p, end, v)) {
+        decoded_ = -1;
+        return false;
+      }
+      q_[j] = record->keyframe ? v : q_[j] + v;
+    }
+  }
+  decoded_ = i;
+
+  for (int j = 0; j < vertices; ++j) {
+    for (int k = 0; k < dim; ++k) {
+      V(j,k) = q_[j*dim + k] * options_.quantum;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mfem {
+
+  // Recorded simulations are stored in a single append-only binary file.
+  // A header holds the rest positions and topology once and is followed by
+  // one record per frame with that frame's vertex positions.
+
+  enum FrameEncoding {
+    FRAME_DOUBLE,    // lossless
+    FRAME_FLOAT,     // single precision
+    FRAME_QUANTIZED  // positions rounded to a grid and stored as variable
+                     // length integers, as deltas from the previous frame
+                     // between keyframes
+  };
+
+  struct FrameCacheOptions {
+    FrameEncoding encoding = FRAME_DOUBLE;
+
+    // Grid spacing of FRAME_QUANTIZED. Positions are off by at most half.
+    double quantum = 1e-5;
+
+    // Every n-th FRAME_QUANTIZED frame stores absolute positions, so
+    // readers can start decoding there
+    int keyframe_interval = 30;
+
+    // Frames queued for the writer thread before write() blocks
+    int max_pending = 16;
+  };
+
+  struct Frame {
+    int step;
+    double time;
+    Eigen::MatrixXd V;  // vertex positions, one row per vertex
+  };
+
+  // Appends frames to a frame cache from a background thread, so the
+  // simulation only pays for copying the positions.
+  class FrameCacheWriter {
+  public:
+
+    // path - output file, truncated if it exists
+    // V0   - rest positions, one row per vertex. Every frame has the same
+    //        number of vertices and coordinates.
+    // T    - elements (or faces) of the mesh
+    FrameCacheWriter(const std::string& path, const Eigen::MatrixXd& V0,
+        const Eigen::MatrixXi& T, const FrameCacheOptions& options = {});
+
+    // Finishes writing the queued frames
+    ~FrameCacheWriter();
+
+    FrameCacheWriter(const FrameCacheWriter&) = delete;
+    FrameCacheWriter& operator=(const FrameCacheWriter&) = delete;
+
+    // False once opening the file or writing a frame failed
+    bool good() const {
+      return !failed_;
+    }
+
+    // Queues the positions V of a frame. Blocks only if max_pending frames
+    // are already waiting to be written.
+    void write(int step, double time, const Eigen::MatrixXd& V);
+
+    // Waits for the queued frames and closes the file. Returns good().
+    bool close();
+
+  private:
+
+    // Writer thread loop
+    void run();
+
+    // Encodes and appends one frame on the writer thread
+    void write_frame(const Frame& frame);
+
+    void write_bytes(const void* data, size_t bytes);
+
+    FrameCacheOptions options_;
+    int vertices_;
+    int dim_;
+    FILE* file_;
+    std::atomic<bool> failed_;
+
+    int frames_ = 0;                 // frames written
+    std::vector<int64_t> q_;         // quantized positions of the last frame
+    std::vector<uint8_t> payload_;   // encoded frame
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Frame> queue_;
+    bool closing_ = false;
+    std::thread thread_;
+  };
+
+  // Reads a frame cache by memory-mapping it. Frames are decoded on
+  // demand, so trajectories of any length can be scrubbed or streamed
+  // without holding more than one frame in memory.
+  class FrameCacheReader {
+  public:
+
+    FrameCacheReader(const std::string& path);
+    ~FrameCacheReader();
+
+    FrameCacheReader(const FrameCacheReader&) = delete;
+    FrameCacheReader& operator=(const FrameCacheReader&) = delete;
+
+    // False if the file is missing or not a frame cache of this version
+    bool good() const {
+      return data_ != nullptr;
+    }
+
+    const Eigen::MatrixXd& rest_positions() const {
+      return V0_;
+    }
+
+    const Eigen::MatrixXi& elements() const {
+      return T_;
+    }
+
+    int vertices() const {
+      return V0_.rows();
+    }
+
+    int dim() const {
+      return V0_.cols();
+    }
+
+    FrameEncoding encoding() const {
+      return options_.encoding;
+    }
+
+    // Number of complete frames. A last frame that is still being written
+    // is left out.
+    int frames() const {
+      return index_.size();
+    }
+
+    // Step and time of frame i, without decoding it
+    int step(int i) const;
+    double time(int i) const;
+
+    // Decodes frame i. Quantized frames are decoded from the closest
+    // keyframe, or from the last frame read if that is closer, so reading
+    // frames in order decodes each frame once.
+    bool read(int i, Frame& frame);
+
+    // Reads the frame after the last one read. Returns false at the end.
+    bool next(Frame& frame) {
+      return read(current_ + 1, frame);
+    }
+
+    // Maps frames appended since the file was opened, e.g. while a
+    // simulation is still recording. Returns the number of frames.
+    int refresh();
+
+  private:
+
+    // Maps the file and indexes the frames past the last indexed one
+    bool map();
+
+    // Decodes frame i into q_ (quantized) or V (otherwise)
+    bool decode(int i, Eigen::MatrixXd& V);
+
+    std::string path_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    FrameCacheOptions options_;
+    Eigen::MatrixXd V0_;
+    Eigen::MatrixXi T_;
+
+    size_t end_ = 0;                   // end of the last indexed frame
+    std::vector<size_t> index_;        // offset of each frame's record
+    std::vector<int> keyframes_;       // last keyframe at or before frame i
+    int current_ = -1;                 // last frame read
+    int decoded_ = -1;                 // frame whose positions q_ holds
+    std::vector<int64_t> q_;
+  };
+
+}
@@ -16,13 +16,10 @@ namespace mfem {
   public:
 
     AffinePCG(std::shared_ptr<Mesh> mesh,
-        std::shared_ptr<SimConfig> config) : config_(config) {
+        std::shared_ptr<SimConfig> config) : mesh_(mesh), config_(config),
+        upper_(config->symmetric_storage), tol_(config->itr_tol) {
 
-      double k = config->h * config->h;
-      k *= mesh->config_->mu;
-      Eigen::SparseMatrixdRowMajor lhs = mesh->mass_matrix()
-          + k * mesh->laplacian();
-      solver_.compute(lhs);
+      factorize_preconditioner(config->h);
 
       //TODO only works in 3D and on tetmeshes
       //build up reduced space
@@ -50,28 +47,125 @@ namespace mfem {
       T0_ = mesh->P()*T0_;
     }
 
+    using LinearSolver<Scalar, Ordering>::compute;
+
     void compute(const Eigen::SparseMatrix<Scalar, Ordering>& A) override {
       lhs_ = A;
+      is_bsr_ = false;
+      op_ = nullptr;
+      if (upper_) {
+        project(lhs_.template selfadjointView<Eigen::Upper>());
+      } else {
+        project(lhs_);
+      }
+    }
+
+    // PCG runs directly on the 3x3 blocks. Block matrices store both
+    // triangles, so unlike lhs_ they are used as is with symmetric storage.
+    void compute(const BSRMatrix<Scalar, 3>& A) override {
+      lhs_bsr_ = A;
+      is_bsr_ = true;
+      op_ = nullptr;
+      project(lhs_bsr_);
+    }
+
+    void compute(const LinearOperator<Scalar>& A) override {
+      op_ = &A;
+      is_bsr_ = false;
+      project(A);
+    }
+
+    // The preconditioner depends on the timestep, so it is refactorized
+    // whenever h changes
+    void set_timestep(Scalar h) override {
+      if (h != h_) {
+        factorize_preconditioner(h);
+      }
+    }
+
+    void set_tolerance(Scalar tol) override {
+      tol_ = tol;
+    }
+
+    int iterations() const override {
+      return iterations_;
     }
 
     Eigen::VectorXx<Scalar> solve(const Eigen::VectorXx<Scalar>& b) override {
+      if (op_ != nullptr) {
+        return solve(*op_, b);
+      } else if (is_bsr_) {
+        return solve(lhs_bsr_, b);
+      } else if (upper_) {
+        return solve(lhs_.template selfadjointView<Eigen::Upper>(), b);
+      } else {
+        return solve(lhs_, b);
+      }
+    }
+
+  private:
+
+    // ARAP-like preconditioner mass + h^2 mu laplacian for timestep h. Its
+    // sparsity pattern is fixed, so it is only analyzed the first time.
+    void factorize_preconditioner(double h) {
+      Eigen::SparseMatrixdRowMajor lhs = mesh_->mass_matrix()
+          + (h * h * mesh_->config_->mu) * mesh_->laplacian();
+      if (h_ == 0) {
+        solver_.analyzePattern(lhs);
+      }
+      solver_.factorize(lhs);
+      h_ = h;
+    }
+
+    // Projects the system onto the affine basis. The projected system
+    // gives the initial guess of every solve until the next compute(), so
+    // the products with the 12 basis vectors are only formed once.
+    template <typename MatrixType>
+    void project(const MatrixType& A) {
+      AT0_ = A * T0_;
+      affine_lu_.compute(T0_.transpose() * AT0_);
+    }
 
+    template <typename MatrixType>
+    Eigen::VectorXx<Scalar> solve(const MatrixType& A,
+        const Eigen::VectorXx<Scalar>& b) {
       Eigen::Matrix<double, 12, 1> x_affine;  
-      x_affine = (T0_.transpose()*lhs_*T0_).lu().solve(T0_.transpose()*b);
+      x_affine = affine_lu_.solve(T0_.transpose()*b);
       x_ = T0_*x_affine;
-      int niter = pcg(x_, lhs_ , b, tmp_r_, tmp_z_, tmp_zm1_, tmp_p_, tmp_Ap_,
-          solver_, config_->itr_tol, config_->max_iterative_solver_iters);
-      std::cout << "  - CG iters: " << niter;
-      double relative_error = (lhs_*x_ - b).norm() / b.norm(); 
-      std::cout << " rel error: " << relative_error << " abs error: " << (lhs_*x_-b).norm() << std::endl;
+      iterations_ = pcg(x_, A, b, tmp_r_, tmp_z_, tmp_zm1_, tmp_p_, tmp_Ap_,
+          solver_, tol_, config_->max_iterative_solver_iters);
+
+      if (config_->show_data) {
+        std::cout << "  - CG iters: " << iterations_;
+
+        // The residual costs another product, so it is left out for
+        // matrix-free systems
+        if (op_ == nullptr) {
+          pcg_multiply(A, x_, tmp_Ap_);
+          tmp_Ap_ -= b;
+          std::cout << " rel error: " << tmp_Ap_.norm() / b.norm()
+                    << " abs error: " << tmp_Ap_.norm();
+        }
+        std::cout << std::endl;
+      }
       return x_;
     }
 
-  private:
+
+    std::shared_ptr<Mesh> mesh_;
     std::shared_ptr<SimConfig> config_;
+    double h_ = 0;  // timestep of the factorized preconditioner
+    bool upper_; // lhs_ only stores its upper triangle
+    Scalar tol_;          // relative residual tolerance
+    int iterations_ = 0;  // CG iterations of the last solve
     Eigen::SparseMatrix<Scalar, Ordering> lhs_;
+    BSRMatrix<Scalar, 3> lhs_bsr_;
+    bool is_bsr_ = false;
+    const LinearOperator<Scalar>* op_ = nullptr;
     Eigen::SimplicialLDLT<Eigen::SparseMatrix<Scalar, Ordering>> solver_;
     Eigen::MatrixXd T0_;
+    Eigen::MatrixXd AT0_;  // system times the affine basis
+    Eigen::PartialPivLU<Eigen::Matrix<double, 12, 12>> affine_lu_;
     Eigen::VectorXd x_;
 
     // CG temp variables
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Eigen/OrderingMethods>
+#include <mutex>
+#include <unordered_map>
+#include "precompute_cache.h"
+
+namespace mfem {
+
+  // Process-wide store of fill-reducing orderings keyed by a hash of the
+  // sparsity pattern. If a directory is set, orderings are also persisted
+  // there so later launches skip the ordering computation.
+  class OrderingCache {
+  public:
+
+    static OrderingCache& instance() {
+      static OrderingCache cache;
+      return cache;
+    }
+
+    // Directory for persistent orderings. Empty disables disk caching.
+    void set_directory(const std::string& dir) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      dir_ = dir;
+    }
+
+    bool find(uint64_t key, std::vector<int>& perm) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = orderings_.find(key);
+      if (it != orderings_.end()) {
+        perm = it->second;
+        return true;
+      }
+      if (!dir_.empty()) {
+        CacheReader reader(cache_path(dir_, "ordering", key), key);
+        if (reader.good() && reader.read(perm)) {
+          orderings_[key] = perm;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void insert(uint64_t key, const std::vector<int>& perm) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      orderings_[key] = perm;
+      if (!dir_.empty()) {
+        CacheWriter writer(cache_path(dir_, "ordering", key), key);
+        writer.write(perm);
+        writer.commit();
+      }
+    }
+
+  private:
+    OrderingCache() = default;
+
+    std::mutex mutex_;
+    std::string dir_;
+    std::unordered_map<uint64_t, std::vector<int>> orderings_;
+  };
+
+  // Drop-in replacement for Eigen::AMDOrdering that reuses the ordering of
+  // any previously seen matrix with the same sparsity pattern.
+  template <typename StorageIndex>
+  class CachedAMDOrdering {
+  public:
+    typedef Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic,
+        StorageIndex> PermutationType;
+
+    template <typename MatrixType>
+    void operator()(const MatrixType& mat, PermutationType& perm) {
+      uint64_t key = pattern_hash(mat);
+
+      // A stale or corrupt ordering is recomputed rather than used
+      std::vector<int> indices;
+      if (OrderingCache::instance().find(key, indices)
+          && is_permutation(indices, mat.cols())) {
+        perm.resize(mat.cols());
+        for (int i = 0; i < mat.cols(); ++i) {
+          perm.indices()(i) = indices[i];
+        }
+        return;
+      }
+
+      Eigen::AMDOrdering<StorageIndex> amd;
+      amd(mat, perm);
+      indices.assign(perm.indices().data(),
+          perm.indices().data() + perm.indices().size());
+      OrderingCache::instance().insert(key, indices);
+    }
+
+  private:
+    // True if indices is a bijection on [0,n)
+    static bool is_permutation(const std::vector<int>& indices, int n) {
+      if (indices.size() != static_cast<size_t>(n)) {
+        return false;
+      }
+      std::vector<bool> seen(n, false);
+      for (int i : indices) {
+        if (i < 0 || i >= n || seen[i]) {
+          return false;
+        }
+        seen[i] = true;
+      }
+      return true;
+    }
+
+    template <typename MatrixType>
+    static uint64_t pattern_hash(const MatrixType& mat) {
+      int64_t dims[2] = {mat.rows(), mat.cols()};
+      uint64_t key = hash_bytes(dims, sizeof(dims));
+      for (int i = 0; i < mat.outerSize(); ++i) {
+        for (typename MatrixType::InnerIterator it(mat, i); it; ++it) {
+          int idx[2] = {i, static_cast<int>(it.index())};
+          key = hash_bytes(idx, sizeof(idx), key);
+        }
+      }
+      return key;
+    }
+  };
+
+}
@@ -8,9 +8,32 @@ namespace mfem {
   class EigenSolver : public LinearSolver<Scalar, Ordering> {
   public:
 
-    EigenSolver() : has_init_(false) {}
+    using LinearSolver<Scalar, Ordering>::compute;
+
+    // expand_upper - if true, input matrices only store their upper
+    //                triangle and are expanded to full storage before
+    //                factorization. Needed for solvers such as LU that read
+    //                both triangles.
+    EigenSolver(bool expand_upper = false)
+        : has_init_(false), expand_upper_(expand_upper) {}
 
     void compute(const Eigen::SparseMatrix<Scalar, Ordering>& A) override {
+      if (expand_upper_) {
+        A_ = A.template selfadjointView<Eigen::Upper>();
+        factorize(A_);
+      } else {
+        factorize(A);
+      }
+    }
+
+    Eigen::VectorXx<Scalar> solve(const Eigen::VectorXx<Scalar>& b) override {
+      assert(has_init_);
+      return solver_.solve(b);
+    }
+
+  private:
+
+    void factorize(const Eigen::SparseMatrix<Scalar, Ordering>& A) {
       if (!has_init_) {
         solver_.analyzePattern(A);
         has_init_ = true;
@@ -22,15 +45,10 @@ namespace mfem {
       }
     }
 
-    Eigen::VectorXx<Scalar> solve(const Eigen::VectorXx<Scalar>& b) override {
-      assert(has_init_);
-      return solver_.solve(b);
-    }
-
-  private:
-
     Solver solver_;
     bool has_init_;
+    bool expand_upper_;
+    Eigen::SparseMatrix<Scalar, Ordering> A_; // full storage copy of input
 
   };
 
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "linear_solver.h"
+#include "pcg.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace mfem {
+
+  // Reuses the factorization of an earlier system across calls to
+  // compute(). Later systems are solved with CG on the current matrix,
+  // preconditioned by the lagged factorization. The matrix is only
+  // refactorized once it drifts too far from the factorized one or when
+  // CG stalls. Meant for stiff, near-static scenes where the Hessian
+  // barely changes between Newton iterations and timesteps.
+  template <int Ordering>
+  class LaggedSolver : public LinearSolver<double, Ordering> {
+  public:
+
+    using LinearSolver<double, Ordering>::compute;
+
+    // solver    - direct solver holding the lagged factorization
+    // upper     - if true, input matrices only store their upper triangle
+    // drift_tol - refactorize once ||A - A_f||_F > drift_tol ||A_f||_F,
+    //             where A_f is the last factorized matrix
+    // max_iters - refactorize if CG does not converge in this many
+    //             iterations
+    // tol       - relative residual tolerance of the CG solves
+    LaggedSolver(std::unique_ptr<LinearSolver<double, Ordering>> solver,
+        bool upper = false, double drift_tol = 0.1, int max_iters = 20,
+        double tol = 1e-4)
+        : solver_(std::move(solver)), upper_(upper), drift_tol_(drift_tol),
+          max_iters_(max_iters), tol_(tol) {}
+
+    void compute(const Eigen::SparseMatrix<double, Ordering>& A) override {
+      A_ = A;
+      A_.makeCompressed();
+      if (!factorized_ || drift() > drift_tol_) {
+        factorize();
+      } else {
+        fresh_ = false;
+      }
+    }
+
+    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
+      iterations_ = 0;
+      reused_ = false;
+      if (fresh_) {
+        return solver_->solve(b);
+      }
+
+      x_ = solver_->solve(b);
+      if (upper_) {
+        iterations_ = pcg(x_, A_.template selfadjointView<Eigen::Upper>(), b,
+            tmp_r_, tmp_z_, tmp_zm1_, tmp_p_, tmp_Ap_, *solver_, tol_,
+            max_iters_);
+      } else {
+        iterations_ = pcg(x_, A_, b, tmp_r_, tmp_z_, tmp_zm1_, tmp_p_,
+            tmp_Ap_, *solver_, tol_, max_iters_);
+      }
+
+      if (iterations_ < max_iters_) {
+        reused_ = true;
+        ++hits_;
+        return x_;
+      }
+
+      // Stalled, so the lagged factorization is no longer a good
+      // preconditioner
+      factorize();
+      return solver_->solve(b);
+    }
+
+    void set_timestep(double h) override {
+      solver_->set_timestep(h);
+    }
+
+    void set_tolerance(double tol) override {
+      tol_ = tol;
+    }
+
+    int iterations() const override {
+      return iterations_;
+    }
+
+    bool reused_factorization() const override {
+      return reused_;
+    }
+
+    // Number of solves served by a lagged factorization
+    int hits() const {
+      return hits_;
+    }
+
+    // Number of factorizations
+    int misses() const {
+      return misses_;
+    }
+
+  private:
+
+    void factorize() {
+      solver_->compute(A_);
+      A_f_ = A_;
+      factorized_ = true;
+      fresh_ = true;
+      ++misses_;
+    }
+
+    // Relative Frobenius distance between A_ and the factorized matrix.
+    // Infinite if their sparsity patterns differ.
+    double drift() const {
+      int nnz = A_.nonZeros();
+      int outer = A_.outerSize();
+      if (A_.rows() != A_f_.rows() || A_.cols() != A_f_.cols()
+          || nnz != A_f_.nonZeros()
+          || !std::equal(A_.outerIndexPtr(), A_.outerIndexPtr() + outer + 1,
+              A_f_.outerIndexPtr())
+          || !std::equal(A_.innerIndexPtr(), A_.innerIndexPtr() + nnz,
+              A_f_.innerIndexPtr())) {
+        return std::numeric_limits<double>::infinity();
+      }
+
+      const double* a = A_.valuePtr();
+      const double* a_f = A_f_.valuePtr();
+      double diff = 0, norm = 0;
+      for (int i = 0; i < nnz; ++i) {
+        diff += (a[i] - a_f[i]) * (a[i] - a_f[i]);
+        norm += a_f[i] * a_f[i];
+      }
+      return std::sqrt(diff / norm);
+    }
+
+    std::unique_ptr<LinearSolver<double, Ordering>> solver_;
+    bool upper_;
+    double drift_tol_;
+    int max_iters_;
+    double tol_;
+
+    Eigen::SparseMatrix<double, Ordering> A_;   // current system
+    Eigen::SparseMatrix<double, Ordering> A_f_; // factorized system
+    bool factorized_ = false;
+    bool fresh_ = false;  // A_ is the factorized system
+    bool reused_ = false; // last solve used a lagged factorization
+    int iterations_ = 0;
+    int hits_ = 0;
+    int misses_ = 0;
+
+    // CG temp variables
+    Eigen::VectorXd x_;
+    Eigen::VectorXd tmp_r_;
+    Eigen::VectorXd tmp_z_;
+    Eigen::VectorXd tmp_zm1_;
+    Eigen::VectorXd tmp_p_;
+    Eigen::VectorXd tmp_Ap_;
+  };
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "EigenTypes.h"
+
+namespace mfem {
+
+  // Abstract matrix-free linear operator. Lets iterative solvers work
+  // with systems that are never assembled.
+  template <typename Scalar>
+  class LinearOperator {
+  public:
+
+    virtual int rows() const = 0;
+    virtual int cols() const = 0;
+
+    // y = A * x
+    virtual void apply(const Eigen::VectorXx<Scalar>& x,
+        Eigen::VectorXx<Scalar>& y) const = 0;
+
+    // Product with a dense vector or matrix, column by column.
+    template <typename Derived>
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime>
+    operator*(const Eigen::MatrixBase<Derived>& x) const {
+      Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> out(
+          rows(), x.cols());
+      Eigen::VectorXx<Scalar> xi, yi;
+      for (int i = 0; i < x.cols(); ++i) {
+        xi = x.col(i);
+        apply(xi, yi);
+        out.col(i) = yi;
+      }
+      return out;
+    }
+
+    virtual ~LinearOperator() = default;
+  };
+
+}
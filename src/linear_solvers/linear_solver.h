@@ -1,6 +1,9 @@
 #pragma once
 
 #include "EigenTypes.h"
+#include "bsr_matrix.h"
+#include "linear_operator.h"
+#include <iostream>
 
 namespace mfem {
 
@@ -11,8 +14,57 @@ namespace mfem {
 
     virtual void compute(const Eigen::SparseMatrix<Scalar, Ordering>& A) = 0;
 
+    // Block sparse systems. By default these are expanded to scalar
+    // sparse storage; iterative solvers may use the blocks directly.
+    // Block matrices store both triangles, which solvers reading only the
+    // upper triangle accept as well.
+    virtual void compute(const BSRMatrix<Scalar, 2>& A) {
+      compute(Eigen::SparseMatrix<Scalar, Ordering>(A.to_csr()));
+    }
+
+    virtual void compute(const BSRMatrix<Scalar, 3>& A) {
+      compute(Eigen::SparseMatrix<Scalar, Ordering>(A.to_csr()));
+    }
+
+    // Systems assembled in single precision (SYSTEM_SINGLE). By default
+    // these are promoted to Scalar; SinglePrecisionSolver factors them
+    // directly.
+    virtual void compute_single(
+        const Eigen::SparseMatrix<float, Ordering>& A) {
+      compute(Eigen::SparseMatrix<Scalar, Ordering>(
+          A.template cast<Scalar>()));
+    }
+
+    // Matrix-free systems. Only supported by iterative solvers. The
+    // operator must outlive subsequent calls to solve().
+    virtual void compute(const LinearOperator<Scalar>& A) {
+      std::cerr << "Solver does not support matrix-free operators"
+          << std::endl;
+      exit(1);
+    }
+
     virtual Eigen::VectorXx<Scalar> solve(const Eigen::VectorXx<Scalar>& b) = 0; 
 
+    // Timestep of subsequent systems, for solvers whose setup depends on
+    // it (e.g. the AffinePCG preconditioner). Others ignore it.
+    virtual void set_timestep(Scalar h) {}
+
+    // Relative residual tolerance ||b - Ax|| / ||b|| of subsequent solves.
+    // Only used by iterative solvers; direct solvers ignore it.
+    virtual void set_tolerance(Scalar tol) {}
+
+    // Number of iterations taken by the last solve. Zero for direct
+    // solvers.
+    virtual int iterations() const {
+      return 0;
+    }
+
+    // Whether the last solve reused the factorization of an earlier
+    // system (see LaggedSolver)
+    virtual bool reused_factorization() const {
+      return false;
+    }
+
     virtual ~LinearSolver() = default;
   };
 
@@ -4,13 +4,38 @@
 #include <Eigen/SVD>
 #include <Eigen/QR>
 #include <limits>
+#include <type_traits>
 #include "optimizers/optimizer_data.h"
+#include "bsr_matrix.h"
+#include "linear_solvers/linear_operator.h"
+
+// y = A * x. Matrix-free operators and block sparse matrices apply
+// themselves in place rather than through operator*, which allocates
+// its result.
+template<typename MatrixType, typename Scalar>
+inline void pcg_multiply(const MatrixType& A,
+    const Eigen::VectorXx<Scalar>& x, Eigen::VectorXx<Scalar>& y) {
+  if constexpr (std::is_base_of_v<mfem::LinearOperator<Scalar>,
+      MatrixType>) {
+    A.apply(x, y);
+  } else {
+    y.noalias() = A * x;
+  }
+}
+
+template<typename Scalar, int B>
+inline void pcg_multiply(const mfem::BSRMatrix<Scalar, B>& A,
+    const Eigen::VectorXx<Scalar>& x, Eigen::VectorXx<Scalar>& y) {
+  A.multiply(x, y);
+}
 
 // Utility for workin with corotational
 //preconditioned conjugate gradient
-template<typename PreconditionerSolver, typename Scalar, int Ordering>
-inline int pcg(Eigen::VectorXx<Scalar>& x,
-    const Eigen::SparseMatrix<Scalar, Ordering> &A,
+// A may be any operator supporting A * x, e.g. a sparse matrix or the
+// selfadjointView of a matrix storing only one triangle, or any operator
+// with a pcg_multiply overload.
+template<typename PreconditionerSolver, typename MatrixType, typename Scalar>
+inline int pcg(Eigen::VectorXx<Scalar>& x, const MatrixType &A,
     const Eigen::VectorXx<Scalar> &b, Eigen::VectorXx<Scalar> &r,
     Eigen::VectorXx<Scalar> &z, Eigen::VectorXx<Scalar> &zm1, Eigen::VectorXx<Scalar> &p,
     Eigen::VectorXx<Scalar> &Ap, PreconditionerSolver &pre,
@@ -21,7 +46,8 @@ inline int pcg(Eigen::VectorXx<Scalar>& x,
       return 0;
     }
   
-    r = b - A * x;
+    pcg_multiply(A, x, r);
+    r = b - r;
 
    if (r.norm()/b.norm() < tol || (r.norm() < std::sqrt(std::numeric_limits<Scalar>::epsilon()))) {
           return 0;
@@ -43,7 +69,7 @@ inline int pcg(Eigen::VectorXx<Scalar>& x,
 
   for(unsigned int i=0; i<num_itr; ++i) {
     //t.start("Ap");
-    Ap = A * p;
+    pcg_multiply(A, p, Ap);
     //t.stop("Ap");
     //t.start("rsnew");
     alpha = rsold / (p.dot(Ap));
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "linear_solver.h"
+#include <memory>
+
+namespace mfem {
+
+  // Double precision interface to a single precision solver. The system
+  // is rounded to float for factorization and each solution is refined
+  // against the double precision residual, so the result converges to
+  // the double precision solution while the factorization and triangular
+  // solves move half the data. Systems assembled in float are factored
+  // as is and refined against their residual accumulated in double.
+  template <int Ordering>
+  class SinglePrecisionSolver : public LinearSolver<double, Ordering> {
+  public:
+
+    using LinearSolver<double, Ordering>::compute;
+
+    // solver       - single precision solver
+    // upper        - if true, input matrices only store their upper
+    //                triangle
+    // refine_iters - number of iterative refinement steps per solve
+    SinglePrecisionSolver(std::unique_ptr<LinearSolver<float, Ordering>> solver,
+        bool upper = false, int refine_iters = 2)
+        : solver_(std::move(solver)), upper_(upper),
+          refine_iters_(refine_iters) {}
+
+    void compute(const Eigen::SparseMatrix<double, Ordering>& A) override {
+      A_ = A;
+      A_single_ = nullptr;
+      solver_->compute(A_.template cast<float>());
+    }
+
+    // The matrix must outlive subsequent calls to solve()
+    void compute_single(
+        const Eigen::SparseMatrix<float, Ordering>& A) override {
+      A_single_ = &A;
+      solver_->compute(A);
+    }
+
+    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
+      Eigen::VectorXd x = solver_->solve(b.cast<float>())
+          .template cast<double>();
+      for (int i = 0; i < refine_iters_; ++i) {
+        Eigen::VectorXd r = b - (A_single_ ? product(*A_single_, x)
+            : product(A_, x));
+        x += solver_->solve(r.cast<float>()).template cast<double>();
+      }
+      return x;
+    }
+
+    void set_timestep(double h) override {
+      solver_->set_timestep(static_cast<float>(h));
+    }
+
+  private:
+
+    // A * x accumulated in double
+    template <typename Scalar>
+    Eigen::VectorXd product(const Eigen::SparseMatrix<Scalar, Ordering>& A,
+        const Eigen::VectorXd& x) const {
+      using Iterator =
+          typename Eigen::SparseMatrix<Scalar, Ordering>::InnerIterator;
+      Eigen::VectorXd y = Eigen::VectorXd::Zero(A.rows());
+      for (int k = 0; k < A.outerSize(); ++k) {
+        for (Iterator it(A, k); it; ++it) {
+          double a = it.value();
+          y(it.row()) += a * x(it.col());
+          if (upper_ && it.row() != it.col()) {
+            y(it.col()) += a * x(it.row());
+          }
+        }
+      }
+      return y;
+    }
+
+    std::unique_ptr<LinearSolver<float, Ordering>> solver_;
+    bool upper_;
+    int refine_iters_;
+    Eigen::SparseMatrix<double, Ordering> A_; // double precision system
+    const Eigen::SparseMatrix<float, Ordering>* A_single_ = nullptr;
+  };
+
+}
@@ -124,7 +124,7 @@ namespace mfem {
 
     //std::cout << "fx0 : " << fx0 << " gTp: " << gTp << std::endl;
 
-    int iter = 0;
+    unsigned int iter = 0;
     while (iter < max_iterations) {
 
       func(x + alpha*d); // callback
@@ -154,45 +154,113 @@ namespace mfem {
         : SolverExitStatus::CONVERGED);
   }
 
+  // Buffers for the variable line searches below. Owned by the caller so
+  // they persist across Newton iterations and timesteps.
+  struct LinesearchWorkspace {
+    Eigen::VectorXd x;    // unprojected displacements at the start
+    Eigen::VectorXd dx;   // unprojected displacement search direction
+  };
+
+  // Evaluation counts of a line search, accumulated over calls. Both the
+  // sequential and the speculative search count passes and evaluations the
+  // same way, so they can be compared directly. The sequential search
+  // wastes and saves nothing.
+  struct LinesearchStats {
+    int passes = 0;       // passes over the elements, each evaluating one
+                          // or more step lengths
+    int evaluations = 0;  // step lengths evaluated, including alpha = 0
+    int wasted = 0;       // candidates evaluated past the accepted one, plus
+                          // every candidate of a rejected pass
+    int saved = 0;        // passes saved over a sequential search that
+                          // evaluates f(0) and then the same candidates one
+                          // per pass up to the accepted one
+  };
+
+  // Caches the search direction in the variables and returns the
+  // directional derivative of the objective along it
+  template <int DIM>
+  double linesearch_begin(const std::shared_ptr<Displacement<DIM>>& x,
+      const std::vector<std::shared_ptr<MixedVariable<DIM>>>& vars,
+      LinesearchWorkspace& ws) {
+    x->unproject(x->value(), ws.x);
+    x->unproject_delta(x->delta(), ws.dx);
+    x->linesearch_begin(ws.x, ws.dx);
+    for (const auto& var : vars) {
+      var->linesearch_begin(ws.x, ws.dx);
+    }
+
+    double gTd = x->gradient().dot(x->delta());
+    for (const auto& var : vars) {
+      gTd += var->gradient().dot(x->delta())
+        + var->gradient_mixed().dot(var->delta());
+    }
+    return gTd;
+  }
+
+  // Line search objective at n step lengths in a single pass
+  template <int DIM>
+  void linesearch_evaluate(const std::shared_ptr<Displacement<DIM>>& x,
+      const std::vector<std::shared_ptr<MixedVariable<DIM>>>& vars,
+      double h2, const double* alpha, int n, double* f) {
+    x->linesearch_values(alpha, n, f);
+    for (const auto& var : vars) {
+      double fi[MAX_LINESEARCH_CANDIDATES];
+      var->linesearch_values(alpha, n, h2, fi);
+      for (int j = 0; j < n; ++j) {
+        f[j] += fi[j];
+      }
+    }
+  }
+
+  // Steps every variable by alpha times its search direction
+  template <int DIM>
+  void linesearch_accept(const std::shared_ptr<Displacement<DIM>>& x,
+      const std::vector<std::shared_ptr<MixedVariable<DIM>>>& vars,
+      double alpha) {
+    x->value() += alpha * x->delta();
+    for (const auto& var : vars) {
+      var->value() += alpha * var->delta();
+    }
+  }
+
+  // Each trial step only evaluates element-local terms. The variables
+  // cache the inertia term as a quadratic in alpha and the per-element
+  // deformation gradients along the search direction up front.
   // x     - Displacement variable
   // vars  - Mixed variables
+  // ws    - Search direction buffers
   // alpha - step size (modified by function)
+  // stats - evaluation counts, accumulated. Every evaluation, including
+  //         f(0), is a pass over the elements.
   // c     - sufficient decrease factor for armijo rule
   // p     - factor by which alpha is decreased
   // func  - callback function
   template <int DIM, typename Scalar,
             class Callback = decltype(default_linesearch_callback)>
   SolverExitStatus linesearch_backtracking_cubic(
-      std::shared_ptr<Displacement<DIM>> x,
-      std::vector<std::shared_ptr<MixedVariable<DIM>>> vars,
-      Scalar& alpha, unsigned int max_iterations, Scalar c=1e-4, Scalar p=0.5,
+      const std::shared_ptr<Displacement<DIM>>& x,
+      const std::vector<std::shared_ptr<MixedVariable<DIM>>>& vars,
+      LinesearchWorkspace& ws,
+      Scalar& alpha, unsigned int max_iterations, LinesearchStats& stats,
+      Scalar c=1e-4, Scalar p=0.5,
       const Callback func = default_linesearch_callback) {
 
     double h2 = std::pow(x->integrator()->dt(),2);
+    Scalar gTd = linesearch_begin(x, vars, ws);
 
-    auto f = [=](double a)->Scalar {
-      Eigen::VectorXd x0 = x->value() + a * x->delta();
-      Scalar val = x->energy(x0);
-      x->unproject(x0);
-      for (int i = 0; i < vars.size(); ++i) {
-        const Eigen::VectorXd si = vars[i]->value() + a * vars[i]->delta();
-        val += h2*vars[i]->energy(si) - vars[i]->constraint_value(x0, si);  
-      }
+    auto f = [&](double a)->Scalar {
+      double val;
+      linesearch_evaluate(x, vars, h2, &a, 1, &val);
+      stats.passes += 1;
+      stats.evaluations += 1;
       return val;
     };
 
-    // Compute gradient dot descent direction
-    Scalar gTd = x->gradient().dot(x->delta());
-    for (int i = 0; i < vars.size(); ++i) {
-      gTd += vars[i]->gradient().dot(x->delta())
-        + vars[i]->gradient_mixed().dot(vars[i]->delta());
-    }
-
     Scalar fx0 = f(0);
     Scalar fx_prev = fx0;
     Scalar alpha_prev = alpha;
 
-    int iter = 0;
+    unsigned int iter = 0;
     while (iter < max_iterations) {
 
       //func(x + alpha*d); // callback
@@ -214,13 +282,99 @@ namespace mfem {
     }
 
     if(iter < max_iterations) {
-      x->value() += alpha * x->delta();
-      for (int i = 0; i < vars.size(); ++i) {
-        vars[i]->value() += alpha * vars[i]->delta();
-      }
+      linesearch_accept(x, vars, alpha);
     }
     return (iter == max_iterations 
         ? SolverExitStatus::MAX_ITERATIONS_REACHED 
         : SolverExitStatus::CONVERGED);
   }
+
+  // Speculative backtracking for machines where a single evaluation does
+  // not saturate the cores. Each pass over the elements evaluates a set of
+  // decreasing step lengths {a, a/2, a/4} at once (the first pass also
+  // evaluates alpha = 0) and accepts the largest one satisfying the Armijo
+  // condition. If none does, the next pass starts from the minimizer of the
+  // quadratic interpolating f(0), f'(0) and the smallest trial, safeguarded
+  // to [0.1, 0.5] times that trial.
+  // x     - Displacement variable
+  // vars  - Mixed variables
+  // ws    - Search direction buffers
+  // alpha - initial step size (modified by function)
+  // max_iterations - maximum number of trial step lengths
+  // stats - evaluation counts, accumulated
+  // c     - sufficient decrease factor for armijo rule
+  template <int DIM, typename Scalar>
+  SolverExitStatus linesearch_speculative(
+      const std::shared_ptr<Displacement<DIM>>& x,
+      const std::vector<std::shared_ptr<MixedVariable<DIM>>>& vars,
+      LinesearchWorkspace& ws, Scalar& alpha, unsigned int max_iterations,
+      LinesearchStats& stats, Scalar c=1e-4) {
+
+    constexpr int n = 3; // candidates per pass
+    static_assert(n + 1 <= MAX_LINESEARCH_CANDIDATES);
+
+    double h2 = std::pow(x->integrator()->dt(),2);
+    Scalar gTd = linesearch_begin(x, vars, ws);
+
+    // First pass evaluates f(0) alongside the candidates
+    double a[n + 1] = {0.0, alpha, 0.5*alpha, 0.25*alpha};
+    double fa[n + 1];
+    linesearch_evaluate(x, vars, h2, a, n + 1, fa);
+    Scalar fx0 = fa[0];
+    const double* trial = a + 1;
+    const double* f_trial = fa + 1;
+
+    stats.passes += 1;
+    stats.evaluations += n + 1;
+    int sequential = 1; // passes of the sequential baseline, f(0) included
+    int passes = 1;
+
+    unsigned int iter = 0;
+    while (true) {
+      int accepted = -1;
+      for (int j = 0; j < n; ++j) {
+        if (f_trial[j] < fx0 + (trial[j] * c) * gTd) {
+          accepted = j;
+          break;
+        }
+      }
+
+      if (accepted >= 0) {
+        sequential += accepted + 1;
+        stats.wasted += n - (accepted + 1);
+        alpha = trial[accepted];
+        break;
+      }
+
+      sequential += n;
+      stats.wasted += n;
+      iter += n;
+      if (iter >= max_iterations) {
+        break;
+      }
+
+      double as = trial[n - 1];
+      double alpha_tmp = gTd * as * as
+          / (2.0 * (fx0 + gTd * as - f_trial[n - 1]));
+      alpha = range(alpha_tmp, 0.1*as, 0.5*as);
+      a[0] = alpha;
+      a[1] = 0.5*alpha;
+      a[2] = 0.25*alpha;
+      linesearch_evaluate(x, vars, h2, a, n, fa);
+      trial = a;
+      f_trial = fa;
+
+      stats.passes += 1;
+      stats.evaluations += n;
+      ++passes;
+    }
+    stats.saved += sequential - passes;
+
+    if (iter < max_iterations) {
+      linesearch_accept(x, vars, alpha);
+    }
+    return (iter >= max_iterations
+        ? SolverExitStatus::MAX_ITERATIONS_REACHED 
+        : SolverExitStatus::CONVERGED);
+  }
 }
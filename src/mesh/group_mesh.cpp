@@ -91,7 +91,7 @@ void GroupMesh::jacobian(std::vector<MatrixXd>& J) {
 }
 
 void GroupMesh::init_jacobian() {
-  Jloc_.resize(T_.rows());
+  Jloc_.resize(T_.rows(), 9, 12);
 
   MatrixXd dphidX;
   sim::linear_tetmesh_dphi_dX(dphidX, V0_, T_);
@@ -103,7 +103,7 @@ void GroupMesh::init_jacobian() {
     Matrix<double,9,12> B;
     Matrix<double, 4,3> dX = sim::unflatten<4,3>(dphidX.row(i));
     local_jacobian(B, dX);
-    Jloc_[i] = B;
+    Jloc_.block<9,12>(i) = B;
 
     // Inserting triplets
     for (int j = 0; j < 9; ++j) {
@@ -3,6 +3,9 @@
 #include "energies/material_model.h"
 #include "config.h"
 #include "pinning_matrix.h"
+#include "precompute_cache.h"
+#include <cstring>
+#include <typeinfo>
 
 using namespace mfem;
 using namespace Eigen;
@@ -50,12 +53,95 @@ void Mesh::init() {
   W_.setFromTriplets(trips.begin(),trips.end());
 
   init_jacobian();
+  init_shape_gradients();
   PJW_ = P_ * J_.transpose() * W_;
 
   mass_matrix(M_, vols_);
   PMP_ = P_ * M_ * P_.transpose();
 }
 
+uint64_t Mesh::cache_key() const {
+  uint64_t key = hash_matrix(V0_);
+  key = hash_matrix(T_, key);
+  key = hash_matrix(is_fixed_, key);
+  key = hash_bytes(&config_->density, sizeof(double), key);
+  const char* type = typeid(*this).name();
+  return hash_bytes(type, strlen(type), key);
+}
+
+bool Mesh::load_cache(const std::string& dir) {
+  if (!cacheable()) {
+    return false;
+  }
+
+  CacheReader reader(cache_path(dir, "mesh", cache_key()), cache_key());
+  if (!reader.good()) {
+    return false;
+  }
+
+  // Read into temporaries so a corrupt file leaves the mesh untouched
+  VectorXd vols;
+  SparseMatrixd W;
+  SparseMatrixdRowMajor J, PJW, M, PMP;
+  ElementBlocks<double> Jloc;
+  if (!(reader.read(vols) && reader.read(W) && reader.read(J)
+      && reader.read(PJW) && reader.read(M) && reader.read(PMP)
+      && reader.read(Jloc))) {
+    return false;
+  }
+  vols_ = std::move(vols);
+  W_ = std::move(W);
+  J_ = std::move(J);
+  PJW_ = std::move(PJW);
+  M_ = std::move(M);
+  PMP_ = std::move(PMP);
+  Jloc_ = std::move(Jloc);
+  init_shape_gradients();
+  return true;
+}
+
+void Mesh::save_cache(const std::string& dir) const {
+  if (!cacheable()) {
+    return;
+  }
+
+  CacheWriter writer(cache_path(dir, "mesh", cache_key()), cache_key());
+  writer.write(vols_);
+  writer.write(W_);
+  writer.write(J_);
+  writer.write(PJW_);
+  writer.write(M_);
+  writer.write(PMP_);
+  writer.write(Jloc_);
+  if (!writer.commit()) {
+    std::cerr << "Failed to write mesh cache to " << dir << std::endl;
+  }
+}
+
+void Mesh::init_shape_gradients() {
+  if (Jloc_.size() != T_.rows()) {
+    return;
+  }
+
+  // Row DIM*j of an element's jacobian holds dphi_k/dX_j of every
+  // node k in columns DIM*k.
+  const int dim = V_.cols();
+  const int nodes = T_.cols();
+  dphidX_blocks_.resize(T_.rows(), nodes, dim);
+
+  const ElementBlocks<double>& J = Jloc_;
+  #pragma omp parallel for
+  for (int i = 0; i < T_.rows(); ++i) {
+    Map<MatrixXd> dX = dphidX_blocks_.block(i);
+    Map<const MatrixXd> Jloc = J.block(i);
+    for (int k = 0; k < nodes; ++k) {
+      for (int j = 0; j < dim; ++j) {
+        dX(k,j) = Jloc(dim*j, dim*k);
+      }
+    }
+  }
+}
+
 void Mesh::clear_fixed_vertices() {
   fixed_vertices_.clear();
   is_fixed_.setZero();
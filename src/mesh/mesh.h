@@ -2,7 +2,9 @@
 
 #include <Eigen/Dense>
 #include <EigenTypes.h>
+#include "element_blocks.h"
 #include <memory>
+#include <string>
 
 #if defined(SIM_USE_CHOLMOD)
 #include <Eigen/CholmodSupport>
@@ -30,6 +32,19 @@ namespace mfem {
     
     virtual void init();
 
+    // Restore the products of init() from an on-disk cache, keyed by the
+    // rest positions, elements, pinned vertices, density, and mesh type.
+    // Returns false on a cache miss, in which case nothing is modified.
+    // dir - cache directory
+    bool load_cache(const std::string& dir);
+
+    // Write the products of init() to the cache. Call after init().
+    void save_cache(const std::string& dir) const;
+
+    // Whether init() products fully describe the mesh state and can be
+    // cached. Meshes that compute additional state must opt out.
+    virtual bool cacheable() const { return false; }
+
     // Compute per-element volumes. Size of "vol" is reset
     // vol - nelem x 1 per-element volumes
     virtual void volumes(Eigen::VectorXd& vol) = 0;
@@ -58,13 +73,25 @@ namespace mfem {
 
     // Defo gradients
     virtual void deformation_gradient(const Eigen::VectorXd& x, Eigen::VectorXd& F) = 0;
+
+    // Vectorized deformation gradient of the i-th element, evaluated
+    // directly from the element's vertices in x and its shape function
+    // gradients. Unlike deformation_gradient(x, F) this forms no global
+    // vector and does no sparse product, so element loops can evaluate F
+    // in the same pass that consumes it. Safe to call concurrently.
+    // i - element index
+    // x - vertex positions (DIM * #V)
+    template <int DIM>
+    Eigen::Matrix<double, DIM*DIM, 1> element_deformation_gradient(int i,
+        const Eigen::VectorXd& x) const;
+
     virtual void init_jacobian() {};
     virtual void update_jacobian(const Eigen::VectorXd& x) {}
     virtual const Eigen::SparseMatrixdRowMajor& jacobian() {
       return PJW_;
     }
 
-    virtual const std::vector<Eigen::MatrixXd>& local_jacobians() {
+    virtual const ElementBlocks<double>& local_jacobians() {
       return Jloc_;
     }
 
@@ -99,6 +126,19 @@ namespace mfem {
 
     void update_free_map();
 
+  protected:
+
+    // Content hash used to key the precomputation cache
+    uint64_t cache_key() const;
+
+    // Extract the per-element shape function gradients from the local
+    // jacobians. Call whenever Jloc_ is (re)initialized.
+    void init_shape_gradients();
+
+    template <int DIM, int NODES>
+    Eigen::Matrix<double, DIM*DIM, 1> linear_deformation_gradient(int i,
+        const Eigen::VectorXd& x) const;
+
   public:
 
     std::vector<std::vector<int>> bc_groups_;
@@ -112,6 +152,9 @@ namespace mfem {
     Eigen::MatrixXd V0_;
     Eigen::MatrixXi T_;
 
+    // Rest normals for surface elements. Empty for volumetric meshes.
+    Eigen::MatrixXd N_;
+
     std::shared_ptr<MaterialModel> material_;
     std::shared_ptr<MaterialConfig> config_;
 
@@ -125,9 +168,52 @@ namespace mfem {
     //Eigen::SparseMatrixd P_;         // pinning constraint (for vertices)
     Eigen::SparseMatrixd W_;           // weight matrix
     Eigen::VectorXd vols_;
-    std::vector<Eigen::MatrixXd> Jloc_;
+
+    // Per-element local jacobians (DIM*DIM x DIM*#nodes)
+    ElementBlocks<double> Jloc_;
+
+    // Per-element shape function gradients, dphi/dX (#nodes x DIM)
+    ElementBlocks<double> dphidX_blocks_;
 
   };
+
+  template <int DIM, int NODES>
+  Eigen::Matrix<double, DIM*DIM, 1> Mesh::linear_deformation_gradient(int i,
+      const Eigen::VectorXd& x) const {
+    Eigen::Map<const Eigen::Matrix<double, NODES, DIM>> dX(
+        dphidX_blocks_.data() + i * NODES * DIM);
+
+    // F = sum_k x_k * dphi_k/dX^T
+    Eigen::Matrix<double, DIM, DIM> F;
+    F.noalias() = x.segment<DIM>(DIM*T_(i,0)) * dX.row(0);
+    for (int k = 1; k < NODES; ++k) {
+      F.noalias() += x.segment<DIM>(DIM*T_(i,k)) * dX.row(k);
+    }
+    return Eigen::Map<Eigen::Matrix<double, DIM*DIM, 1>>(F.data());
+  }
+
+  template <int DIM>
+  Eigen::Matrix<double, DIM*DIM, 1> Mesh::element_deformation_gradient(
+      int i, const Eigen::VectorXd& x) const {
+    assert(dphidX_blocks_.size() == T_.rows());
+
+    if (T_.cols() == DIM + 1) {
+      return linear_deformation_gradient<DIM, DIM + 1>(i, x);
+    }
+
+    // Triangles embedded in 3D. The rest normal is mapped to the unit
+    // normal of the deformed triangle.
+    assert(DIM == 3 && T_.cols() == 3);
+    Eigen::Matrix<double, DIM*DIM, 1> F =
+        linear_deformation_gradient<DIM, 3>(i, x);
+    if constexpr (DIM == 3) {
+      Eigen::Vector3d v1 = x.segment<3>(3*T_(i,1)) - x.segment<3>(3*T_(i,0));
+      Eigen::Vector3d v2 = x.segment<3>(3*T_(i,2)) - x.segment<3>(3*T_(i,0));
+      Eigen::Vector3d n = v1.cross(v2).normalized();
+      Eigen::Map<Eigen::Matrix3d>(F.data()).noalias() += n * N_.row(i);
+    }
+    return F;
+  }
 }
 
 // Add discretizations
@@ -24,5 +24,7 @@ namespace mfem {
         Eigen::VectorXd& F) override;
     void init_jacobian() override;
 
+    bool cacheable() const override { return true; }
+
   };
 }
@@ -42,7 +42,7 @@ void Tri2DMesh::mass_matrix(Eigen::SparseMatrixdRowMajor& M,
 }
 
 void Tri2DMesh::init_jacobian() {
-  Jloc_.resize(T_.rows());
+  Jloc_.resize(T_.rows(), 4, 6);
 
   std::vector<Triplet<double>> trips;
   for (int i = 0; i < T_.rows(); ++i) { 
@@ -52,7 +52,7 @@ void Tri2DMesh::init_jacobian() {
     Matrix32d dX = sim::unflatten<3,2>(dphidX_.row(i));
     local_jacobian(B, dX);
 
-    Jloc_[i] = B;
+    Jloc_.block<4,6>(i) = B;
 
     for (int j = 0; j < 4; ++j) {
 
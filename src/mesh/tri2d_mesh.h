@@ -24,10 +24,12 @@ namespace mfem {
 
     void init_jacobian() override;
 
+    bool cacheable() const override { return true; }
+
     bool fixed_jacobian() override { 
       return true;
     }
-    const std::vector<Eigen::MatrixXd>& local_jacobians() override{
+    const ElementBlocks<double>& local_jacobians() override{
       return Jloc_;
     }
 
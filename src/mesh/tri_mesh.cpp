@@ -31,7 +31,8 @@ TriMesh::TriMesh(const Eigen::MatrixXd& V, const Eigen::MatrixXi& T,
     const Eigen::MatrixXd& N,
     std::shared_ptr<MaterialModel> material,
     std::shared_ptr<MaterialConfig> material_config)
-    : Mesh(V,T,material,material_config), N_(N) {
+    : Mesh(V,T,material,material_config) {
+  N_ = N;
   sim::linear_tri3dmesh_dphi_dX(dphidX_, V0_, T_);
 }
 
@@ -69,7 +70,7 @@ void TriMesh::mass_matrix(Eigen::SparseMatrixdRowMajor& M,
 }
 
 void TriMesh::init_jacobian() {
-  Jloc_.resize(T_.rows());
+  Jloc_.resize(T_.rows(), 9, 9);
 
   std::vector<Triplet<double>> trips;
   for (int i = 0; i < T_.rows(); ++i) { 
@@ -79,7 +80,7 @@ void TriMesh::init_jacobian() {
     Matrix3d dX = sim::unflatten<3,3>(dphidX_.row(i));
     local_jacobian(B, dX);
 
-    Jloc_[i] = B;
+    Jloc_.block<9,9>(i) = B;
 
     for (int j = 0; j < 9; ++j) {
 
@@ -183,7 +184,7 @@ void TriMesh::deformation_gradient(const VectorXd& x, VectorXd& F) {
 void TriMesh::update_jacobian(const VectorXd& x) {
   assert(x.size() == J_.cols());
 
-  Jloc_.resize(T_.rows());
+  Jloc_.resize(T_.rows(), 9, 9);
 
   auto cross_product_mat = [](const RowVector3d& v)-> Matrix3d {
     Matrix3d mat;
@@ -221,7 +222,8 @@ void TriMesh::update_jacobian(const VectorXd& x) {
     dn_dq.block<3,3>(0,0) = dx2 - dx1;
     dn_dq.block<3,3>(0,3) = -dx2;
     dn_dq.block<3,3>(0,6) = dx1;
-    Jloc_[i] = Jloc0_[i]
+    Map<Matrix9d> Jloc = Jloc_.block<9,9>(i);
+    Jloc = Jloc0_.block<9,9>(i)
         + N * (Matrix3d::Identity() - n*n.transpose()) * dn_dq / l;
 
     
@@ -233,7 +235,7 @@ void TriMesh::update_jacobian(const VectorXd& x) {
 
         // x,y,z index for the k-th vertex
         for (int l = 0; l < 3; ++l) {
-          double val = Jloc_[i](j,3*k+l);
+          double val = Jloc(j,3*k+l);
           trips.push_back(Triplet<double>(9*i+j, 3*vid+l, val));
         }
       }
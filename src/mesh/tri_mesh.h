@@ -28,18 +28,16 @@ namespace mfem {
     bool fixed_jacobian() override { 
       return false;
     }
-    const std::vector<Eigen::MatrixXd>& local_jacobians() override{
+    const ElementBlocks<double>& local_jacobians() override{
       return Jloc_;
     }
 
-    Eigen::MatrixXd N_;
-
   private:
     Eigen::MatrixXd dphidX_;
 
     // Constant components of the jacobian
     Eigen::SparseMatrixdRowMajor J0_;
-    std::vector<Eigen::MatrixXd> Jloc0_;
+    ElementBlocks<double> Jloc0_;
 
   };
 }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace mfem {
+
+  // Eisenstat-Walker forcing terms for inexact Newton methods (choice 2 in
+  // "Choosing the forcing terms in an inexact Newton method", 1996). Each
+  // Newton system is solved to a relative tolerance eta_k that follows the
+  // decrease of the nonlinear residual
+  //   eta_k = gamma * (||r_k|| / ||r_{k-1}||)^alpha
+  // so early iterations far from the solution get loose linear solves and
+  // the tolerance tightens as Newton converges.
+  class ForcingTerm {
+  public:
+
+    // eta_min - floor on the tolerance (the fixed tolerance used otherwise)
+    // eta_max - tolerance of the first iteration and ceiling on the rest
+    ForcingTerm(double eta_min = 1e-4, double eta_max = 0.5,
+        double gamma = 0.9, double alpha = 2.0)
+        : eta_min_(eta_min), eta_max_(eta_max), gamma_(gamma),
+          alpha_(alpha), eta_(eta_max) {}
+
+    // Restart the sequence, e.g. at the start of a timestep
+    void reset(double eta_min, double eta_max) {
+      eta_min_ = eta_min;
+      eta_max_ = eta_max;
+      residual_prev_ = -1;
+      eta_ = eta_max_;
+    }
+
+    // Relative tolerance for the solve at a residual of norm ||r_k||
+    double next(double residual) {
+      if (residual_prev_ > 0) {
+        double eta = gamma_ * std::pow(residual / residual_prev_, alpha_);
+
+        // Safeguard against the tolerance dropping too quickly when the
+        // residual happens to decrease a lot in one iteration
+        double eta_safe = gamma_ * std::pow(eta_, alpha_);
+        if (eta_safe > 0.1) {
+          eta = std::max(eta, eta_safe);
+        }
+        eta_ = std::clamp(eta, eta_min_, eta_max_);
+      }
+      residual_prev_ = residual;
+      return std::max(eta_, eta_min_);
+    }
+
+  private:
+    double eta_min_;
+    double eta_max_;
+    double gamma_;
+    double alpha_;
+    double eta_;                  // last forcing term
+    double residual_prev_ = -1;   // ||r_{k-1}||, negative before the first
+  };
+
+}
@@ -14,7 +14,7 @@
 
 #include <fstream>
 #include "unsupported/Eigen/SparseExtra"
-#include <svd/newton_procrustes.h>
+#include "svd/batch_polar.h"
 
 
 using namespace mfem;
@@ -22,23 +22,6 @@ using namespace Eigen;
 using namespace std::chrono;
 
 
-static const Eigen::Matrix<double, 9,9> Id = []{
-  
-  Matrix<double, 9,9> tmp;
-  tmp.setZero();
-
-  for(unsigned int ll=0; ll<3; ++ll) {
-    for(unsigned int mm=0; mm<3; ++mm) {
-      tmp(ll + 3*mm, ll+3*mm) = 1.0;
-    }
-  }
-
-  return tmp;
-
-}();
-
-  
-
 double MixedOptimizer::primal_energy(const VectorXd& x, const VectorXd& s, 
     VectorXd& gx, VectorXd& gs) {
 
@@ -49,16 +32,29 @@ double MixedOptimizer::primal_energy(const VectorXd& x, const VectorXd& s,
 
   double Em = 0.5*xdiff.dot(gx);
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(xt, def_grad);
-
   gs.resize(s.size());
   double Epsi = 0;
+  const Vector6d I = (Vector6d() << 1,1,1,0,0,0).finished();
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
+
   #pragma omp parallel for reduction(+ : Epsi)
-  for (int i = 0; i < nelem_; ++i) {
-    const Vector6d& si = s.segment<6>(6*i);
-    Epsi += mesh_->material_->energy(si) * vols_[i];
-    gs.segment<6>(6*i) = h*h*mesh_->material_->gradient(si) * vols_[i];
+  for (int b = 0; b < nbatch; ++b) {
+    int lanes = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    LaneMatrix<double,6,1> S, g;
+    lane_load(s, b, nelem_, S);
+    for (int l = lanes; l < BATCH_WIDTH; ++l) {
+      S.set(l, I);
+    }
+
+    double psi[BATCH_WIDTH];
+    mesh_->material_->energy(S, psi);
+    mesh_->material_->gradient(S, g);
+
+    for (int l = 0; l < lanes; ++l) {
+      int i = BATCH_WIDTH*b + l;
+      Epsi += psi[l] * vols_[i];
+      gs.segment<6>(6*i) = h*h*g.get(l) * vols_[i];
+    }
   }
   return Em + h*h*Epsi;
 }
@@ -217,61 +213,45 @@ void MixedOptimizer::update_rotations() {
   data_.timer.start("Rot Update");
   dS_.resize(nelem_);
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(P_.transpose()*x_+b_, def_grad);
-
-  #pragma omp parallel for 
-  for (int i = 0; i < nelem_; ++i) {
+  VectorXd x = P_.transpose()*x_ + b_;
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
 
-    Matrix<double, 9, 9> J;
-    
-    //polar decomp code
-    Eigen::Matrix<double, 9,9> dRdF;
-    
-    //orthogonlity sanity check
-    if((R_[i].transpose()*R_[i] - Matrix3d::Identity()).norm() > 1e-6) {
-        //Vector3d sigma;
-        //Matrix3d U,V;
-        //svd<double,3>(R_[i], sigma, U, V);
-        //R_[i] = U*V.transpose();
-        std::cout<<"in here\n";
-        exit(1);
+  #pragma omp parallel for
+  for (int b = 0; b < nbatch; ++b) {
+    LaneMatrix<double,3,3> R;
+    LaneMatrix<double,6,1> s;
+    LaneMatrix<double,6,9> dsdF;
+    batch_rotations(b, x, R, s, &dsdF);
+
+    int n = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    for (int l = 0; l < n; ++l) {
+      int i = BATCH_WIDTH*b + l;
+      R_[i] = R.get(l);
+      S_[i] = s.get(l);
+      dS_[i] = dsdF.get(l).transpose()*Sym;
     }
-
-
-    newton_procrustes(R_[i], Eigen::Matrix3d::Identity(), 
-        sim::unflatten<3,3>(def_grad.segment(9*i,9)), true, dRdF, 1e-6, 100);
-    
- 
-    Eigen::Matrix3d Sf = R_[i].transpose()
-        * sim::unflatten<3,3>(def_grad.segment(9*i,9));
-
-    Sf = 0.5*(Sf+Sf.transpose());
-    S_[i] << Sf(0,0), Sf(1,1), Sf(2,2), Sf(1,0), Sf(2,0), Sf(2,1);
-    
-
-    //R_[i] = R;
-
-    //std::cout<<"HEERE \n: "<<Id<<"\n";
-    J = sim::flatten_multiply<Eigen::Matrix3d>(R_[i].transpose())
-        * (Id - sim::flatten_multiply_right<Eigen::Matrix3d>(Sf)*dRdF);
-    //J = sim::flatten_multiply_right<Eigen::Matrix3d>(Sf)*dRdF;
-    //std::cout<<"HEERE 2\n";
-    //check result
-    //std::cout<<"ERROR IN UPDATE ROTATIONS ******************** "<<(J-test_J).norm()<<"\n";
-    
-    Matrix<double, 6, 9> Js;
-    Js.row(0) = J.row(0);
-    Js.row(1) = J.row(4);
-    Js.row(2) = J.row(8);
-    Js.row(3) = 0.5*(J.row(1) + J.row(3));
-    Js.row(4) = 0.5*(J.row(2) + J.row(6));
-    Js.row(5) = 0.5*(J.row(5) + J.row(7));
-    dS_[i] = Js.transpose()*Sym;
   }
   data_.timer.stop("Rot Update");
 }
 
+void MixedOptimizer::batch_rotations(int b, const VectorXd& x,
+    LaneMatrix<double,3,3>& R, LaneMatrix<double,6,1>& s,
+    LaneMatrix<double,6,9>* dsdF) {
+  LaneMatrix<double,3,3> F;
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    int i = BATCH_WIDTH*b + l;
+    if (i < nelem_) {
+      Vector9d Fi = mesh_->element_deformation_gradient<3>(i, x);
+      F.set(l, Map<Matrix3d>(Fi.data()));
+      R.set(l, R_[i]);
+    } else {
+      F.set(l, Matrix3d::Identity());
+      R.set(l, Matrix3d::Identity());
+    }
+  }
+  batch_polar(F, R, s, dsdF);
+}
+
 bool MixedOptimizer::linesearch_x(VectorXd& x, const VectorXd& dx) {
   data_.timer.start("LS_x");
   auto value = [&](const VectorXd& x)->double {
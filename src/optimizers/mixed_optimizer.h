@@ -1,6 +1,7 @@
 #pragma once
 
 #include "optimizers/optimizer.h"
+#include "batch_matrix.h"
 
 #if defined(SIM_USE_CHOLMOD)
 #include <Eigen/CholmodSupport>
@@ -55,6 +56,16 @@ namespace mfem {
     // For a new set of positions, update R,S and their derivatives
     virtual void update_rotations();
 
+    // Polar decompositions of the deformation gradients of the elements in
+    // lane group b, warm started from R_. Padding lanes use the identity.
+    // x    - full vertex positions
+    // R    - per-lane rotations
+    // s    - per-lane vectorized stretches
+    // dsdF - if not null, per-lane stretch jacobians
+    void batch_rotations(int b, const Eigen::VectorXd& x,
+        LaneMatrix<double,3,3>& R, LaneMatrix<double,6,1>& s,
+        LaneMatrix<double,6,9>* dsdF = nullptr);
+
     // Linesearch over positions
     // x  - initial positions. Output of linesearch updates this variable
     // dx - direction we perform linesearch on
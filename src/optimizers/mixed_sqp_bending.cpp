@@ -7,7 +7,6 @@
 #include "svd/svd_eigen.h"
 #include "linesearch.h"
 #include "linear_solvers/pcg.h"
-#include "svd/newton_procrustes.h"
 #include "energies/material_model.h"
 #include "mesh/mesh.h"
 
@@ -102,16 +101,16 @@ void MixedSQPBending::build_lhs() {
   
   data_.timer.start("Local H");
 
-  const std::vector<MatrixXd>& Jloc = mesh_->local_jacobians();
-  std::vector<MatrixXd> Hloc(nelem_); 
+  const ElementBlocks<double>& Jloc = mesh_->local_jacobians();
   #pragma omp parallel for
   for (int i = 0; i < nelem_; ++i) {
-    Hloc[i] = (Jloc[i].transpose() * (dS_[i] * H_[i]
-        * dS_[i].transpose()) * Jloc[i]) * (vols_[i] * vols_[i]);
+    Map<const Matrix9d> J = Jloc.block<9,9>(i);
+    Hloc_[i].noalias() = (J.transpose() * (dS_[i] * H_[i]
+        * dS_[i].transpose()) * J) * (vols_[i] * vols_[i]);
   }
   data_.timer.stop("Local H");
   data_.timer.start("Update LHS");
-  assembler_->update_matrix(Hloc);
+  assembler_->update_matrix(Hloc_);
   data_.timer.stop("Update LHS");
 
   lhs_ = M_ + assembler_->A + Ha2;
@@ -224,36 +223,32 @@ void MixedSQPBending::update_rotations() {
   data_.timer.start("Rot Update");
   dS_.resize(nelem_);
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(P_.transpose()*x_+b_, def_grad);
-
-  #pragma omp parallel for 
-  for (int i = 0; i < nelem_; ++i) {
+  VectorXd x = P_.transpose()*x_ + b_;
 
-    Matrix<double, 9, 9> J;
-    
-    //polar decomp code
-    Eigen::Matrix<double, 9,9> dRdF;
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
 
-    newton_procrustes(R_[i], Eigen::Matrix3d::Identity(), 
-        sim::unflatten<3,3>(def_grad.segment(9*i,9)), true, dRdF, 1e-6, 100);
-    
-    Eigen::Matrix3d Sf = R_[i].transpose()
-        * sim::unflatten<3,3>(def_grad.segment(9*i,9));
-
-    Sf = 0.5*(Sf+Sf.transpose());
-    S_[i] << Sf(0,0), Sf(2,2), Sf(2,0);
-
-    J = sim::flatten_multiply<Eigen::Matrix3d>(R_[i].transpose())
-        * (Matrix9d::Identity() 
-           - sim::flatten_multiply_right<Eigen::Matrix3d>(Sf)*dRdF);
-
-    Matrix<double, 3, 9> Js;
-    Js.row(0) = J.row(0);
-    Js.row(1) = J.row(8);
-    Js.row(2) = 0.5*(J.row(2) + J.row(6));
-    //Js.row(2) = 0.5*(J.row(5) + J.row(7));
-    dS_[i] = Js.transpose()*Sym3;
+  #pragma omp parallel for 
+  for (int b = 0; b < nbatch; ++b) {
+    LaneMatrix<double,3,3> R;
+    LaneMatrix<double,6,1> s;
+    LaneMatrix<double,6,9> dsdF;
+    batch_rotations(b, x, R, s, &dsdF);
+
+    // Only the in-plane stretches S00, S22 and S20 are used
+    int n = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    for (int l = 0; l < n; ++l) {
+      int i = BATCH_WIDTH*b + l;
+      Vector6d si = s.get(l);
+      Matrix<double,6,9> J = dsdF.get(l);
+      R_[i] = R.get(l);
+      S_[i] << si(0), si(2), si(4);
+
+      Matrix<double, 3, 9> Js;
+      Js.row(0) = J.row(0);
+      Js.row(1) = J.row(2);
+      Js.row(2) = J.row(4);
+      dS_[i] = Js.transpose()*Sym3;
+    }
   }
   data_.timer.stop("Rot Update");
 }
@@ -266,9 +261,6 @@ double MixedSQPBending::energy(const VectorXd& x, const VectorXd& s,
   VectorXd xdiff = P_ * (wx_*xt + wx0_*x0_ + wx1_*x1_ + wx2_*x2_ - h*h*f_ext_);
   double Em = 0.5*xdiff.transpose()*M_*xdiff;
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(xt, def_grad);
-
   VectorXd ax;
   normals(xt, n_);
   angles(xt, n_, ax);
@@ -280,25 +272,29 @@ double MixedSQPBending::energy(const VectorXd& x, const VectorXd& s,
   // }
 
   double e = 0;
-  #pragma omp parallel for reduction( + : e )
-  for (int i = 0; i < nelem_; ++i) {
-  
-    Matrix3d R = R_[i];
-    newton_procrustes(R, Matrix3d::Identity(), Map<Matrix3d>(def_grad.segment<9>(9*i).data()));
-    Matrix3d S = R.transpose()*Eigen::Map<Matrix3d>(def_grad.segment<9>(9*i).data());
-
-  //std::cout << "Si: \n" << S << std::endl;
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
 
-    Vector3d stmp; 
-    stmp << S(0,0), S(2,2), 0.5*(S(2,0) + S(0,2));
-    if ( (S(1,1) - 1.0) > 1e-12) {
-      std::cout << "S: " << S << std::endl;
-    }
+  #pragma omp parallel for reduction( + : e )
+  for (int b = 0; b < nbatch; ++b) {
+    LaneMatrix<double,3,3> R;
+    LaneMatrix<double,6,1> S;
+    batch_rotations(b, xt, R, S);
+
+    int n = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    for (int l = 0; l < n; ++l) {
+      int i = BATCH_WIDTH*b + l;
+      Vector6d Si = S.get(l);
+      Vector3d stmp; 
+      stmp << Si(0), Si(2), Si(4);
+      if ( (Si(1) - 1.0) > 1e-12) {
+        std::cout << "S: " << Si.transpose() << std::endl;
+      }
     
-    const Vector3d& si = s.segment<3>(3*i);
-    Vector3d diff = Sym3 * (stmp - si);
-    e += h2 * mesh_->material_->energy(si) * vols_[i]
-        - la.segment<3>(3*i).dot(diff) * vols_[i];
+      const Vector3d& si = s.segment<3>(3*i);
+      Vector3d diff = Sym3 * (stmp - si);
+      e += h2 * mesh_->material_->energy(si) * vols_[i]
+          - la.segment<3>(3*i).dot(diff) * vols_[i];
+    }
   }
   e += (Em + el);
   return e;
@@ -472,9 +468,10 @@ void MixedSQPBending::reset() {
     }
   }
 
-  assembler_ = std::make_shared<Assembler<double,3,-1>>(mesh_->T_, mesh_->free_map_);
-  vec_assembler_  = std::make_shared<VecAssembler<double,3,-1>>(mesh_->T_,
-      mesh_->free_map_);
+  Hloc_.resize(nelem_);
+  assembler_ = std::make_shared<Assembler<double,3,3>>(mesh_->T_, mesh_->free_map_);
+  vec_assembler_  = std::make_shared<VecAssembler<double,3,3>>(mesh_->T_,
+      mesh_->free_map_, true);
 
 
   // SQP PD //
@@ -95,8 +95,9 @@ namespace mfem {
     std::vector<Eigen::Vector3d> g_;    // Elemental gradients w.r.t dS
     std::vector<Eigen::Matrix<double,9,3>> dS_;
 
-    std::shared_ptr<Assembler<double,3,-1>> assembler_;
-    std::shared_ptr<VecAssembler<double,3,-1>> vec_assembler_;
+    std::vector<Eigen::Matrix9d> Hloc_; // per-element LHS blocks
+    std::shared_ptr<Assembler<double,3,3>> assembler_;
+    std::shared_ptr<VecAssembler<double,3,3>> vec_assembler_;
 
     std::shared_ptr<LinearSolver<double, Eigen::RowMajor>> solver_;
     Eigen::VectorXd gl_;
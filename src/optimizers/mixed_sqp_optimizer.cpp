@@ -7,7 +7,6 @@
 #include "linear_solvers/pcg.h"
 // #include "linsolver/nasoq_lbl_eigen.h"
 #include "svd/svd_eigen.h"
-#include "svd/newton_procrustes.h"
 #include "energies/material_model.h"
 #include "mesh/mesh.h"
 
@@ -35,8 +34,12 @@ void MixedSQPOptimizer::build_lhs() {
     // H_[i] = - ih2 * vols_[i] *  Sym * (Hinv_[i]) * Sym;
   }
 
-  SparseMatrixd GxT = Gx_.transpose();
-  fill_block_matrix(M_, GxT, H_, lhs_);
+  // Gx_ is column-major, so its storage reinterpreted as row-major is the
+  // transpose. This avoids a copy when refreshing the KKT values.
+  Map<const SparseMatrix<double, RowMajor>> GxT(Gx_.cols(), Gx_.rows(),
+      Gx_.nonZeros(), Gx_.outerIndexPtr(), Gx_.innerIndexPtr(),
+      Gx_.valuePtr());
+  kkt_assembler_->update(M_, GxT, H_, lhs_);
 
   data_.timer.stop("LHS");
 }
@@ -89,8 +92,15 @@ void MixedSQPOptimizer::update_system() {
 
   // Assemble rotation derivatives into block matrices
   data_.timer.start("Gx");
-  update_block_diagonal(dS_, C_);
-  Gx_ = -P_ * J_.transpose() * C_.eval() * W_;
+  // Columns 6i..6i+5 of Gx_ are stored contiguously as a dense
+  // block over the rows in element i's stencil, so Gx_ = -P*J^T*C*W
+  // is refreshed in place without a sparse matrix product.
+  #pragma omp parallel for
+  for (int i = 0; i < nelem_; ++i) {
+    Map<MatrixXd> Gxi(Gx_.valuePtr() + Gx_.outerIndexPtr()[6*i],
+        PJe_[i].rows(), 6);
+    Gxi.noalias() = -vols_[i] * PJe_[i] * dS_[i];
+  }
   data_.timer.stop("Gx");
 
   // Assemble blocks for left and right hand side
@@ -252,31 +262,26 @@ double MixedSQPOptimizer::energy(const VectorXd& x, const VectorXd& s,
   VectorXd xdiff = P_ * (wx_*xt + wx0_*x0_ + wx1_*x1_ + wx2_*x2_ - h*h*f_ext_);
   double Em = 0.5*xdiff.transpose()*M_*xdiff;
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(xt, def_grad);
-
   VectorXd e_L(nelem_);
   VectorXd e_Psi(nelem_);
   // data_.timer.stop("1");
 
-  //svd3x3_sse(def_grad, U_, sigma_, V_);
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
 
   #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-  
-  //   std::cout<<"F: \n"<<sim::unflatten<3,3>(def_grad.segment<9>(9*i))<<"\n";
-    Matrix3d R = R_[i];
-    newton_procrustes(R, Matrix3d::Identity(), Eigen::Map<Matrix3d>(def_grad.segment<9>(9*i).data()));
-    Matrix3d S = R.transpose()*Eigen::Map<Matrix3d>(def_grad.segment<9>(9*i).data());
-  
-    //std::cout<<"R: \n"<<R_[i]<<"\n";
-    //std::cout<<"S: \n"<<S<<"\n";
-    //Matrix3f S = V_[i] * sigma_[i].asDiagonal() * V_[i].transpose();
-    Vector6d stmp; stmp << S(0,0), S(1,1), S(2,2), 0.5*(S(1,0) + S(0,1)), 0.5*(S(2,0) + S(0,2)), 0.5*(S(2,1) + S(1,2));
-    const Vector6d& si = s.segment<6>(6*i);
-    Vector6d diff = Sym * (stmp - si);
-    e_L(i) = la.segment<6>(6*i).dot(diff) * vols_[i];
-    e_Psi(i) = mesh_->material_->energy(si) * vols_[i];
+  for (int b = 0; b < nbatch; ++b) {
+    LaneMatrix<double,3,3> R;
+    LaneMatrix<double,6,1> stmp;
+    batch_rotations(b, xt, R, stmp);
+
+    int n = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    for (int l = 0; l < n; ++l) {
+      int i = BATCH_WIDTH*b + l;
+      const Vector6d& si = s.segment<6>(6*i);
+      Vector6d diff = Sym * (stmp.get(l) - si);
+      e_L(i) = la.segment<6>(6*i).dot(diff) * vols_[i];
+      e_Psi(i) = mesh_->material_->energy(si) * vols_[i];
+    }
   }
   double Ela = e_L.sum();
   double Epsi = h2 * e_Psi.sum();
@@ -298,8 +303,6 @@ void MixedSQPOptimizer::reset() {
   PJ_ = P_ * Jw_.transpose();
   PM_ = P_ * Mfull_;
 
-  init_block_diagonal<9,6>(C_, nelem_);
-
   // Initialize volume sparse matrix
   W_.resize(nelem_*6, nelem_*6);
   std::vector<Triplet<double>> trips;
@@ -335,4 +338,49 @@ void MixedSQPOptimizer::reset() {
   assembler_ = std::make_shared<Assembler<double,3,-1>>(mesh_->T_, free_map);
   vec_assembler_ = std::make_shared<VecAssembler<double,3,4>>(mesh_->T_,
       free_map);
+
+  // Per-element dense slices of P*J^T. Each element only touches the rows
+  // of its free vertices, so these are small dense blocks.
+  SparseMatrixd PJt = P_ * J_.transpose();
+  PJe_.resize(nelem_);
+  std::vector<std::vector<int>> rows(nelem_);
+
+  #pragma omp parallel for
+  for (int i = 0; i < nelem_; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      for (SparseMatrixd::InnerIterator it(PJt, 9*i+j); it; ++it) {
+        rows[i].push_back(it.row());
+      }
+    }
+    std::sort(rows[i].begin(), rows[i].end());
+    rows[i].erase(std::unique(rows[i].begin(), rows[i].end()), rows[i].end());
+
+    PJe_[i].resize(rows[i].size(), 9);
+    PJe_[i].setZero();
+    for (int j = 0; j < 9; ++j) {
+      for (SparseMatrixd::InnerIterator it(PJt, 9*i+j); it; ++it) {
+        int r = std::lower_bound(rows[i].begin(), rows[i].end(), it.row())
+            - rows[i].begin();
+        PJe_[i](r, j) = it.value();
+      }
+    }
+  }
+
+  // Symbolic structure of Gx_. Values are filled in update_system().
+  trips.clear();
+  for (int i = 0; i < nelem_; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      for (int r : rows[i]) {
+        trips.push_back(Triplet<double>(r, 6*i+j, 0.0));
+      }
+    }
+  }
+  Gx_.resize(P_.rows(), 6*nelem_);
+  Gx_.setFromTriplets(trips.begin(), trips.end());
+  Gx_.makeCompressed();
+
+  // Build the KKT sparsity once; subsequent iterations only update values.
+  SparseMatrix<double, RowMajor> GxT = Gx_.transpose();
+  kkt_assembler_ = std::make_shared<BlockMatrixAssembler<6,RowMajor,RowMajor,
+      RowMajor>>(M_, GxT, H_, lhs_);
 }
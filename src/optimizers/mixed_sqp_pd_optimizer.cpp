@@ -1,6 +1,6 @@
 #include "mixed_sqp_pd_optimizer.h"
 
-#include "linesearch.h"
+#include "alloc_counter.h"
 #include "mesh/mesh.h"
 #include "factories/solver_factory.h"
 #include "factories/integrator_factory.h"
@@ -12,6 +12,49 @@ template <int DIM>
 void MixedSQPPDOptimizer<DIM>::step() {
   data_.clear();
 
+  if (config_->adaptive_timestep) {
+    // State at the start of the step to retry from. Besides the
+    // stretches, the multipliers and the rotations the polar
+    // decompositions are warm started from are restored.
+    x0_ = xvar_->value();
+    svar_->save_state(s0_);
+    timestep_.step(*xvar_->integrator(),
+        [&](VectorXd& x) {
+          bool converged = solve_timestep();
+          xvar_->unproject(xvar_->value(), x);
+          return converged;
+        },
+        [&]() {
+          xvar_->value() = x0_;
+          svar_->load_state(s0_);
+        });
+  } else {
+    solve_timestep();
+  }
+
+  if (config_->show_data) {
+    data_.print_data(config_->show_timing);
+  }
+
+  {
+    NoAllocationScope guard("SQP-PD post_solve", steady_state_);
+    xvar_->post_solve();
+    svar_->post_solve();
+  }
+  if (config_->adaptive_timestep) {
+    xvar_->integrator()->set_timestep(timestep_.next());
+  }
+  steady_state_ = true;
+}
+
+template <int DIM>
+bool MixedSQPPDOptimizer<DIM>::solve_timestep() {
+  forcing_.reset(config_->itr_tol, config_->inexact_eta_max);
+
+  if (config_->warm_start) {
+    predict();
+  }
+
   int i = 0;
   double grad_norm;
   double E = 0, E_prev = 0;
@@ -37,8 +80,18 @@ void MixedSQPPDOptimizer<DIM>::step() {
 
     // Linesearch on descent direction
     double alpha = 1.0;
-    SolverExitStatus status = linesearch_backtracking_cubic(xvar_, {svar_}, alpha,
-        config_->ls_iters);
+    SolverExitStatus status;
+    LinesearchStats ls_stats;
+    {
+      NoAllocationScope guard("SQP-PD linesearch", steady_state_);
+      if (config_->ls_speculative) {
+        status = linesearch_speculative(xvar_, mixed_vars_, ls_workspace_,
+            alpha, config_->ls_iters, ls_stats);
+      } else {
+        status = linesearch_backtracking_cubic(xvar_, mixed_vars_,
+            ls_workspace_, alpha, config_->ls_iters, ls_stats);
+      }
+    }
 
     // Record some data
     data_.add(" Iteration", i+1);
@@ -46,40 +99,78 @@ void MixedSQPPDOptimizer<DIM>::step() {
     data_.add("mixed E res", res);
     // data_.add("mixed grad", grad_.norm());
     data_.add("Newton dec", grad_norm);
+    if (config_->solver_type == SolverType::SOLVER_AFFINE_PCG) {
+      data_.add("CG tol", tol_);
+      data_.add("CG iters", solver_->iterations());
+    }
+    if (config_->lagged_factorization) {
+      data_.add("Factor reused", solver_->reused_factorization());
+      data_.add("Lagged CG iters", solver_->iterations());
+    }
+    data_.add("LS passes", ls_stats.passes);
+    data_.add("LS evals", ls_stats.evaluations);
+    data_.add("LS wasted", ls_stats.wasted);
+    data_.add("LS saved", ls_stats.saved);
+    if (config_->adaptive_timestep) {
+      data_.add("h", xvar_->integrator()->h());
+    }
     ++i;
 
   } while (i < config_->outer_steps && grad_norm > config_->newton_tol
     /*`&& (res > 1e-12)*/);
 
-  if (config_->show_data) {
-    data_.print_data(config_->show_timing);
-  }
+  return grad_norm <= config_->newton_tol;
+}
+
+template <int DIM>
+void MixedSQPPDOptimizer<DIM>::predict() {
+  xvar_->predict(x_full_);
 
-  xvar_->post_solve();
-  svar_->post_solve();
+  if (!mesh_->fixed_jacobian()) {
+    mesh_->update_jacobian(x_full_);
+  }
+  svar_->predict(x_full_);
 }
 
 template <int DIM>
 void MixedSQPPDOptimizer<DIM>::update_system() {
 
-  VectorXd x = xvar_->value();
-  xvar_->unproject(x);
+  xvar_->unproject(xvar_->value(), x_full_);
 
   if (!mesh_->fixed_jacobian()) {
-    mesh_->update_jacobian(x);
+    mesh_->update_jacobian(x_full_);
   }
 
-  svar_->update(x, xvar_->integrator()->dt());
+  svar_->update(x_full_, xvar_->integrator()->dt());
 
   // Assemble blocks for left and right hand side
-  lhs_ = xvar_->lhs() + svar_->lhs();
+  if (block_storage_) {
+    lhs_bsr_ = xvar_->lhs_bsr();
+    lhs_bsr_ += svar_->lhs_bsr();
+  } else if (single_precision_) {
+    lhs_f_ = xvar_->lhs_single() + svar_->lhs_single();
+  } else if (!op_) {
+    lhs_ = xvar_->lhs() + svar_->lhs();
+  }
+
+  NoAllocationScope guard("SQP-PD rhs", steady_state_);
   rhs_ = xvar_->rhs() + svar_->rhs();
 }
 
 template <int DIM>
 void MixedSQPPDOptimizer<DIM>::substep(double& decrement) {
   data_.timer.start("global");
-  solver_->compute(lhs_);
+  solver_->set_timestep(xvar_->integrator()->h());
+  if (op_) {
+    solver_->compute(*op_);
+  } else if (block_storage_) {
+    solver_->compute(lhs_bsr_);
+  } else if (single_precision_) {
+    solver_->compute_single(lhs_f_);
+  } else {
+    solver_->compute(lhs_);
+  }
+  solver_->set_tolerance(tolerance());
   xvar_->delta() = solver_->solve(rhs_);
   data_.timer.stop("global");
 
@@ -91,17 +182,58 @@ void MixedSQPPDOptimizer<DIM>::substep(double& decrement) {
                        svar_->delta().template lpNorm<Infinity>());
 }
 
+template <int DIM>
+double MixedSQPPDOptimizer<DIM>::tolerance() {
+  tol_ = config_->inexact_newton ? forcing_.next(rhs_.norm())
+                                 : config_->itr_tol;
+  return tol_;
+}
+
+template <int DIM>
+void MixedSQPPDOptimizer<DIM>::save_state(Checkpoint& ckpt) const {
+  ckpt.key = this->checkpoint_key();
+  this->save_material(ckpt);
+  xvar_->save_state(ckpt);
+  svar_->save_state(ckpt);
+}
+
+template <int DIM>
+bool MixedSQPPDOptimizer<DIM>::load_state(const Checkpoint& ckpt) {
+  if (ckpt.key != this->checkpoint_key() || !xvar_->load_state(ckpt)
+      || !svar_->load_state(ckpt) || !this->load_material(ckpt)) {
+    reset();
+    return false;
+  }
+  return true;
+}
+
 template <int DIM>
 void MixedSQPPDOptimizer<DIM>::reset() {
   Optimizer<DIM>::reset();
 
-  svar_ = std::make_shared<Stretch<DIM>>(mesh_);
+  // Direct solvers need the assembled system
+  bool matrix_free = config_->matrix_free
+      && config_->solver_type == SolverType::SOLVER_AFFINE_PCG;
+
+  svar_ = std::make_shared<Stretch<DIM>>(mesh_, config_);
+  svar_->set_matrix_free(matrix_free);
   svar_->reset();
   xvar_ = std::make_shared<Displacement<DIM>>(mesh_, config_);
   xvar_->reset();
+  mixed_vars_ = {svar_};
 
   SolverFactory solver_factory;
   solver_ = solver_factory.create(config_->solver_type, mesh_, config_);
+
+  op_ = nullptr;
+  if (matrix_free) {
+    op_ = std::make_shared<MixedSQPPDOperator<DIM>>(xvar_, svar_,
+        config_->symmetric_storage);
+  }
+  block_storage_ = !matrix_free && config_->block_storage
+      && config_->system_precision == SYSTEM_DOUBLE;
+  single_precision_ = !matrix_free
+      && config_->system_precision == SYSTEM_SINGLE;
 }
 
 template class mfem::MixedSQPPDOptimizer<3>;
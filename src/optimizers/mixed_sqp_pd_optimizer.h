@@ -4,6 +4,10 @@
 #include "variables/stretch.h"
 #include "variables/displacement.h"
 #include "linear_solvers/linear_solver.h"
+#include "linear_solvers/linear_operator.h"
+#include "linesearch.h"
+#include "optimizers/forcing_term.h"
+#include "time_integrators/timestep_controller.h"
 
 
 #if defined(SIM_USE_CHOLMOD)
@@ -12,6 +16,41 @@
 
 namespace mfem {
 
+  // Schur complement system of the SQP-PD optimizer applied matrix-free.
+  // The displacement LHS (mass matrix) is applied from its sparse storage
+  // and the stretch term from its per-element blocks.
+  template <int DIM>
+  class MixedSQPPDOperator : public LinearOperator<double> {
+  public:
+
+    MixedSQPPDOperator(std::shared_ptr<Displacement<DIM>> xvar,
+        std::shared_ptr<Stretch<DIM>> svar, bool upper)
+        : xvar_(xvar), svar_(svar), upper_(upper) {}
+
+    int rows() const override {
+      return xvar_->lhs().rows();
+    }
+
+    int cols() const override {
+      return xvar_->lhs().cols();
+    }
+
+    void apply(const Eigen::VectorXd& x, Eigen::VectorXd& y) const override {
+      if (upper_) {
+        y.noalias() = xvar_->lhs().template selfadjointView<Eigen::Upper>()
+            * x;
+      } else {
+        y.noalias() = xvar_->lhs() * x;
+      }
+      svar_->apply_lhs(x, y);
+    }
+
+  private:
+    std::shared_ptr<Displacement<DIM>> xvar_;
+    std::shared_ptr<Stretch<DIM>> svar_;
+    bool upper_; // displacement LHS only stores its upper triangle
+  };
+
   // Mixed FEM Sequential Quadratic Program
   template <int DIM>
   class MixedSQPPDOptimizer : public Optimizer<DIM> {
@@ -21,7 +60,8 @@ namespace mfem {
   public:
     
     MixedSQPPDOptimizer(std::shared_ptr<Mesh> mesh,
-        std::shared_ptr<SimConfig> config) : Optimizer<DIM>(mesh, config) {}
+        std::shared_ptr<SimConfig> config) : Optimizer<DIM>(mesh, config),
+        timestep_(config) {}
 
     static std::string name() {
       return "SQP-PD";
@@ -29,26 +69,65 @@ namespace mfem {
 
     void step() override;
     void reset() override;
+    void save_state(Checkpoint& ckpt) const override;
+    bool load_state(const Checkpoint& ckpt) override;
 
   private:
 
     using Base::mesh_;
     using Base::data_;
     using Base::config_;
+    using Base::steady_state_;
+
+    // Newton iterations for the integrator's current timestep. Returns
+    // whether they reached newton_tol.
+    bool solve_timestep();
+
+    // Warm start the timestep from the integrator's predicted positions
+    void predict();
 
     // Update gradients, LHS, RHS for a new configuration
     void update_system();
 
     void substep(double& decrement);
 
+    // Relative tolerance of the next linear solve. The forcing term of the
+    // current residual for inexact Newton, itr_tol otherwise.
+    double tolerance();
+
     // linear system left hand side
     Eigen::SparseMatrix<double, Eigen::RowMajor> lhs_; 
 
+    // linear system left hand side in block storage, used in place of
+    // lhs_ if block_storage is enabled
+    BSRMatrix<double, DIM> lhs_bsr_;
+    bool block_storage_ = false;
+
+    // linear system left hand side in single precision, used in place of
+    // lhs_ if system_precision is SYSTEM_SINGLE
+    Eigen::SparseMatrix<float, Eigen::RowMajor> lhs_f_;
+    bool single_precision_ = false;
+
     // linear system right hand side
     Eigen::VectorXd rhs_;       
 
+    // unprojected displacements
+    Eigen::VectorXd x_full_;
+
     std::shared_ptr<Stretch<DIM>> svar_;
     std::shared_ptr<Displacement<DIM>> xvar_;
+    std::vector<std::shared_ptr<MixedVariable<DIM>>> mixed_vars_;
+    LinesearchWorkspace ls_workspace_;
     std::shared_ptr<LinearSolver<double, Eigen::RowMajor>> solver_;
+    ForcingTerm forcing_;
+    double tol_ = 0; // tolerance of the last linear solve
+
+    // Adaptive timestepping and the start of step values it retries from
+    TimestepController timestep_;
+    Eigen::VectorXd x0_;
+    Checkpoint s0_; // stretch variable state
+
+    // Matrix-free Schur complement, used in place of lhs_ if enabled
+    std::shared_ptr<MixedSQPPDOperator<DIM>> op_;
   };
 }
@@ -1,6 +1,6 @@
 #include "newton_optimizer.h"
 
-#include "linesearch.h"
+#include "alloc_counter.h"
 #include "energies/material_model.h"
 #include "mesh/mesh.h"
 #include "factories/solver_factory.h"
@@ -13,8 +13,44 @@ using namespace std::chrono;
 template <int DIM>
 void NewtonOptimizer<DIM>::step() {
   data_.clear();
+
+  if (config_->adaptive_timestep) {
+    // Values at the start of the step to retry from
+    x0_ = xvar_->value();
+    timestep_.step(*xvar_->integrator(),
+        [&](VectorXd& x) {
+          bool converged = solve_timestep();
+          xvar_->unproject(xvar_->value(), x);
+          return converged;
+        },
+        [&]() {
+          xvar_->value() = x0_;
+        });
+  } else {
+    solve_timestep();
+  }
+
+  data_.print_data();
+  {
+    NoAllocationScope guard("Newton post_solve", steady_state_);
+    xvar_->post_solve();
+  }
+  if (config_->adaptive_timestep) {
+    xvar_->integrator()->set_timestep(timestep_.next());
+  }
+  steady_state_ = true;
+}
+
+template <int DIM>
+bool NewtonOptimizer<DIM>::solve_timestep() {
+  forcing_.reset(config_->itr_tol, config_->inexact_eta_max);
   E_prev_ = 0;
 
+  // Warm start from the integrator's predicted positions
+  if (config_->warm_start) {
+    xvar_->predict(x_full_);
+  }
+
   int i = 0;
   double grad_norm;
   do {
@@ -26,25 +62,39 @@ void NewtonOptimizer<DIM>::step() {
     //   step_x0 = x0_;
     // }
 
-    VectorXd x = xvar_->value();
-    xvar_->unproject(x);
+    xvar_->unproject(xvar_->value(), x_full_);
 
     if (!mesh_->fixed_jacobian()) {
-      mesh_->update_jacobian(x);
+      mesh_->update_jacobian(x_full_);
     }
 
-    xvar_->update(x,0.);
+    xvar_->update(x_full_,0.);
 
     // Assemble blocks for left and right hand side
-    lhs_ = xvar_->lhs();
-    rhs_ = xvar_->rhs();
+    if (!block_storage_ && !single_precision_) {
+      lhs_ = xvar_->lhs();
+    }
+    {
+      NoAllocationScope guard("Newton rhs", steady_state_);
+      rhs_ = xvar_->rhs();
+    }
 
     // Compute search direction
     substep(grad_norm);
 
     double alpha = 1.0;
-    SolverExitStatus status = linesearch_backtracking_cubic(xvar_, {}, alpha,
-        config_->ls_iters);
+    SolverExitStatus status;
+    LinesearchStats ls_stats;
+    {
+      NoAllocationScope guard("Newton linesearch", steady_state_);
+      if (config_->ls_speculative) {
+        status = linesearch_speculative(xvar_, mixed_vars_, ls_workspace_,
+            alpha, config_->ls_iters, ls_stats);
+      } else {
+        status = linesearch_backtracking_cubic(xvar_, mixed_vars_,
+            ls_workspace_, alpha, config_->ls_iters, ls_stats);
+      }
+    }
     bool done = status == MAX_ITERATIONS_REACHED;
 
     double E = xvar_->energy(xvar_->value());
@@ -54,25 +104,46 @@ void NewtonOptimizer<DIM>::step() {
     data_.add("Energy res", res);
     data_.add("||H^-1 g||", grad_norm);
     data_.add("||g||", rhs_.norm());
+    if (config_->solver_type == SolverType::SOLVER_AFFINE_PCG) {
+      data_.add("CG tol", tol_);
+      data_.add("CG iters", solver_->iterations());
+    }
+    if (config_->lagged_factorization) {
+      data_.add("Factor reused", solver_->reused_factorization());
+      data_.add("Lagged CG iters", solver_->iterations());
+    }
+    data_.add("LS passes", ls_stats.passes);
+    data_.add("LS evals", ls_stats.evaluations);
+    data_.add("LS wasted", ls_stats.wasted);
+    data_.add("LS saved", ls_stats.saved);
+    if (config_->adaptive_timestep) {
+      data_.add("h", xvar_->integrator()->h());
+    }
 
     E_prev_ = E;
 
     ++i;
   } while (i < config_->outer_steps && grad_norm > config_->newton_tol);
 
-  data_.print_data();
-  xvar_->post_solve();
+  return grad_norm <= config_->newton_tol;
 }
 
 template <int DIM>
 void NewtonOptimizer<DIM>::substep(double& decrement) {
   // Factorize and solve system
-  solver_->compute(lhs_);
+  solver_->set_timestep(xvar_->integrator()->h());
+  if (block_storage_) {
+    solver_->compute(xvar_->lhs_bsr());
+  } else if (single_precision_) {
+    solver_->compute_single(xvar_->lhs_single());
+  } else {
+    solver_->compute(lhs_);
+  }
 
   // Solve for update
+  solver_->set_tolerance(tolerance());
   xvar_->delta() = solver_->solve(rhs_);
 
-  double relative_error = (lhs_*xvar_->delta() - rhs_).norm() / rhs_.norm();
   decrement = xvar_->delta().norm();
   //decrement = dx_.dot(rhs_);
 }
@@ -99,6 +170,30 @@ void NewtonOptimizer<DIM>::set_state(const Eigen::VectorXd& x,
   // std::cout << "set_state: " << vt_.norm() << std::endl;
 }
 
+template <int DIM>
+double NewtonOptimizer<DIM>::tolerance() {
+  tol_ = config_->inexact_newton ? forcing_.next(rhs_.norm())
+                                 : config_->itr_tol;
+  return tol_;
+}
+
+template <int DIM>
+void NewtonOptimizer<DIM>::save_state(Checkpoint& ckpt) const {
+  ckpt.key = this->checkpoint_key();
+  this->save_material(ckpt);
+  xvar_->save_state(ckpt);
+}
+
+template <int DIM>
+bool NewtonOptimizer<DIM>::load_state(const Checkpoint& ckpt) {
+  if (ckpt.key != this->checkpoint_key() || !xvar_->load_state(ckpt)
+      || !this->load_material(ckpt)) {
+    reset();
+    return false;
+  }
+  return true;
+}
+
 template <int DIM>
 void NewtonOptimizer<DIM>::reset() {
   // Reset variables
@@ -110,6 +205,9 @@ void NewtonOptimizer<DIM>::reset() {
 
   SolverFactory solver_factory;
   solver_ = solver_factory.create(config_->solver_type, mesh_, config_);
+  block_storage_ = config_->block_storage
+      && config_->system_precision == SYSTEM_DOUBLE;
+  single_precision_ = config_->system_precision == SYSTEM_SINGLE;
 }
 
 template class mfem::NewtonOptimizer<3>;
@@ -4,6 +4,9 @@
 #include "variables/displacement.h"
 #include "sparse_utils.h"
 #include "linear_solvers/linear_solver.h"
+#include "linesearch.h"
+#include "optimizers/forcing_term.h"
+#include "time_integrators/timestep_controller.h"
 
 #if defined(SIM_USE_CHOLMOD)
 #include <Eigen/CholmodSupport>
@@ -20,7 +23,8 @@ namespace mfem {
   public:
     
     NewtonOptimizer(std::shared_ptr<Mesh> mesh,
-        std::shared_ptr<SimConfig> config) : Optimizer<DIM>(mesh, config) {}
+        std::shared_ptr<SimConfig> config) : Optimizer<DIM>(mesh, config),
+        timestep_(config) {}
 
     static std::string name() {
       return "Newton";
@@ -31,28 +35,56 @@ namespace mfem {
     virtual void update_vertices(const Eigen::MatrixXd& V) override;
     virtual void set_state(const Eigen::VectorXd& x,
         const Eigen::VectorXd& v) override;
+    void save_state(Checkpoint& ckpt) const override;
+    bool load_state(const Checkpoint& ckpt) override;
 
   private:
 
     using Base::mesh_;
     using Base::data_;
     using Base::config_;
+    using Base::steady_state_;
 
     // Simulation substep for this object
     // init_guess - whether to initialize guess with a prefactor solve
     // decrement  - newton decrement norm
     virtual void substep(double& decrement);
 
+    // Newton iterations for the integrator's current timestep. Returns
+    // whether they reached newton_tol.
+    bool solve_timestep();
+
+    // Relative tolerance of the next linear solve. The forcing term of the
+    // current residual for inexact Newton, itr_tol otherwise.
+    double tolerance();
+
     // linear system right hand side
     Eigen::VectorXd rhs_;       
 
     // linear system left hand side
     Eigen::SparseMatrix<double, Eigen::RowMajor> lhs_;
 
+    // Solve the displacement LHS in block storage (xvar_->lhs_bsr())
+    bool block_storage_ = false;
+
+    // Solve the displacement LHS in single precision (xvar_->lhs_single())
+    bool single_precision_ = false;
+
+    // unprojected displacements
+    Eigen::VectorXd x_full_;
+
     double E_prev_; // energy from last result of linesearch
     std::shared_ptr<Displacement<DIM>> xvar_;
+    std::vector<std::shared_ptr<MixedVariable<DIM>>> mixed_vars_; // empty
+    LinesearchWorkspace ls_workspace_;
 
     std::shared_ptr<LinearSolver<double, Eigen::RowMajor>> solver_;
+    ForcingTerm forcing_;
+    double tol_ = 0; // tolerance of the last linear solve
+
+    // Adaptive timestepping and the start of step values it retries from
+    TimestepController timestep_;
+    Eigen::VectorXd x0_;
 
   };
 }
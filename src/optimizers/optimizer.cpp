@@ -2,6 +2,9 @@
 #include "pinning_matrix.h"
 #include "mesh/mesh.h"
 #include "time_integrators/BDF.h"
+#include "linear_solvers/cached_ordering.h"
+#include "precompute_cache.h"
+#include "config.h"
 
 using namespace mfem;
 using namespace Eigen;
@@ -10,6 +13,7 @@ using namespace Eigen;
 template <int DIM>
 void Optimizer<DIM>::reset() {
   nelem_ = mesh_->T_.rows();
+  steady_state_ = false;
   mesh_->V_ = mesh_->V0_;
   mesh_->clear_fixed_vertices();
   
@@ -21,7 +25,42 @@ void Optimizer<DIM>::reset() {
 
   P_ = pinning_matrix(mesh_->V_, mesh_->T_, mesh_->is_fixed_, false);
   mesh_->update_free_map();
-  mesh_->init();
+
+  OrderingCache::instance().set_directory(config_->cache_dir);
+  if (config_->cache_dir.empty() || !mesh_->load_cache(config_->cache_dir)) {
+    mesh_->init();
+    if (!config_->cache_dir.empty()) {
+      mesh_->save_cache(config_->cache_dir);
+    }
+  }
+}
+
+template <int DIM>
+uint64_t Optimizer<DIM>::checkpoint_key() const {
+  return hash_matrix(mesh_->T_, hash_matrix(mesh_->V0_));
+}
+
+template <int DIM>
+void Optimizer<DIM>::save_material(Checkpoint& ckpt) const {
+  const MaterialConfig& mat = *mesh_->config_;
+  ckpt.set("material", (VectorXd(7) << mat.material_model, mat.ym, mat.pr,
+      mat.mu, mat.la, mat.density, mat.thickness).finished());
+}
+
+template <int DIM>
+bool Optimizer<DIM>::load_material(const Checkpoint& ckpt) {
+  MaterialConfig& mat = *mesh_->config_;
+  VectorXd m;
+  if (!ckpt.get("material", m) || m.size() != 7
+      || m(0) != mat.material_model || m(5) != mat.density) {
+    return false;
+  }
+  mat.ym = m(1);
+  mat.pr = m(2);
+  mat.mu = m(3);
+  mat.la = m(4);
+  mat.thickness = m(6);
+  return true;
 }
 
 template class mfem::Optimizer<3>;
@@ -4,6 +4,7 @@
 #include <memory>
 #include "optimizer_data.h"
 #include "boundary_conditions.h"
+#include "checkpoint.h"
 #include "time_integrators/implicit_integrator.h"
 
 namespace mfem {
@@ -34,6 +35,11 @@ namespace mfem {
     virtual void reset();
     virtual void step() = 0;
 
+    // Convergence data and timings recorded during the last step
+    const OptimizerData& data() const {
+      return data_;
+    }
+
     virtual void update_vertices(const Eigen::MatrixXd& V) {
       std::cerr << "Update vertices not implemented!" << std::endl;
     }
@@ -41,6 +47,24 @@ namespace mfem {
         const Eigen::VectorXd& v) {
       std::cerr << "Update state not implemented!" << std::endl;
     }
+
+    // Saves everything needed to resume the simulation from the current
+    // step. Sets the checkpoint's key to checkpoint_key().
+    virtual void save_state(Checkpoint& ckpt) const {
+      std::cerr << "Checkpoints not implemented!" << std::endl;
+    }
+
+    // Restores a state saved by save_state(). Call after reset(). Returns
+    // false, leaving the simulation reset, if the checkpoint doesn't match
+    // this simulation.
+    virtual bool load_state(const Checkpoint& ckpt) {
+      std::cerr << "Checkpoints not implemented!" << std::endl;
+      return false;
+    }
+
+    // Identifies the mesh in checkpoints, so a checkpoint can't be
+    // restored into a different simulation
+    uint64_t checkpoint_key() const;
     
     // Temporary. Should be a part of a callback function instead.
     // Used to save per substep vertices;
@@ -53,6 +77,11 @@ namespace mfem {
     
   protected:
 
+    // Material parameters in checkpoints. Restoring fails if the material
+    // model or density differ, since those are baked into the mesh.
+    void save_material(Checkpoint& ckpt) const;
+    bool load_material(const Checkpoint& ckpt);
+
     OptimizerData data_;
     std::shared_ptr<Mesh> mesh_;
     std::shared_ptr<SimConfig> config_;
@@ -66,6 +95,10 @@ namespace mfem {
     // Eigen::SparseMatrixd P_;          // pinning constraint (for vertices)
     int nelem_;             // number of elements
 
+    // Set after the first step since reset(). By then the buffers reused
+    // by the step loop are sized and it should no longer allocate.
+    bool steady_state_ = false;
+
   };        
   
 }
@@ -0,0 +1,174 @@
+#include "precompute_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace mfem;
+using namespace Eigen;
+
+namespace {
+
+  // Bump when the layout of any cached data changes
+  constexpr uint32_t CACHE_VERSION = 2;
+  constexpr char CACHE_MAGIC[8] = {'M','F','E','M','C','A','C','H'};
+
+  struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t padding;
+    uint64_t key;
+  };
+}
+
+uint64_t mfem::hash_bytes(const void* data, size_t bytes, uint64_t seed) {
+  const unsigned char* ptr = static_cast<const unsigned char*>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < bytes; ++i) {
+    hash ^= ptr[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::string mfem::cache_path(const std::string& dir,
+    const std::string& prefix, uint64_t key) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%016llx",
+      static_cast<unsigned long long>(key));
+  return dir + "/" + prefix + "_" + buffer + ".bin";
+}
+
+CacheWriter::CacheWriter(const std::string& path, uint64_t key)
+    : path_(path), tmp_path_(path + ".tmp") {
+  file_ = fopen(tmp_path_.c_str(), "wb");
+  if (file_ == nullptr) {
+    return;
+  }
+
+  CacheHeader header;
+  std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  header.version = CACHE_VERSION;
+  header.padding = 0;
+  header.key = key;
+  write_bytes(&header, sizeof(header));
+}
+
+CacheWriter::~CacheWriter() {
+  if (file_ != nullptr) {
+    fclose(file_);
+    std::remove(tmp_path_.c_str());
+  }
+}
+
+void CacheWriter::write_bytes(const void* data, size_t bytes) {
+  if (file_ == nullptr) {
+    return;
+  }
+
+  // Keep every array 8 byte aligned so mapped reads are aligned
+  static const char zeros[8] = {0};
+  size_t pad = (8 - bytes % 8) % 8;
+  if (fwrite(data, 1, bytes, file_) != bytes
+      || fwrite(zeros, 1, pad, file_) != pad) {
+    fclose(file_);
+    std::remove(tmp_path_.c_str());
+    file_ = nullptr;
+  }
+}
+
+bool CacheWriter::commit() {
+  if (file_ == nullptr) {
+    return false;
+  }
+  bool ok = (fclose(file_) == 0);
+  file_ = nullptr;
+  ok = ok && (std::rename(tmp_path_.c_str(), path_.c_str()) == 0);
+  if (!ok) {
+    std::remove(tmp_path_.c_str());
+  }
+  return ok;
+}
+
+void CacheWriter::write(const VectorXd& a) {
+  write(a.data(), a.size());
+}
+
+void CacheWriter::write(const ElementBlocks<double>& A) {
+  int64_t dims[3] = {A.size(), A.rows(), A.cols()};
+  write(dims, 3);
+  write(A.data(), static_cast<uint64_t>(A.size()) * A.rows() * A.cols());
+}
+
+CacheReader::CacheReader(const std::string& path, uint64_t key)
+    : good_(false), data_(nullptr), size_(0), pos_(0) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(CacheHeader)) {
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (ptr != MAP_FAILED) {
+      data_ = static_cast<const char*>(ptr);
+      size_ = st.st_size;
+    }
+  }
+  close(fd);
+
+  if (data_ == nullptr) {
+    return;
+  }
+
+  const CacheHeader* header = reinterpret_cast<const CacheHeader*>(data_);
+  good_ = std::memcmp(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0
+      && header->version == CACHE_VERSION
+      && header->key == key;
+  pos_ = sizeof(CacheHeader);
+}
+
+CacheReader::~CacheReader() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+const void* CacheReader::read_bytes(size_t bytes) {
+  size_t padded = bytes + (8 - bytes % 8) % 8;
+  if (!good_ || padded > size_ - pos_) {
+    good_ = false;
+    return nullptr;
+  }
+  const void* ptr = data_ + pos_;
+  pos_ += padded;
+  return ptr;
+}
+
+bool CacheReader::read(VectorXd& a) {
+  uint64_t n;
+  const double* data = read<double>(n);
+  if (data == nullptr) return fail();
+  a = Map<const VectorXd>(data, n);
+  return true;
+}
+
+bool CacheReader::read(ElementBlocks<double>& A) {
+  uint64_t n, m;
+  const int64_t* dims = read<int64_t>(n);
+  if (dims == nullptr || n != 3 || dims[0] < 0 || dims[1] < 0
+      || dims[2] < 0) {
+    return fail();
+  }
+  const double* data = read<double>(m);
+  if (data == nullptr
+      || m != static_cast<uint64_t>(dims[0] * dims[1] * dims[2])) {
+    return fail();
+  }
+  A.resize(dims[0], dims[1], dims[2]);
+  std::copy(data, data + m, A.data());
+  return true;
+}
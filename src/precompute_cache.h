@@ -0,0 +1,215 @@
+#pragma once
+
+#include <EigenTypes.h>
+#include "element_blocks.h"
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace mfem {
+
+  // Utilities for caching expensive precomputation (mesh operators,
+  // fill-reducing orderings) on disk between launches. Cache files are
+  // keyed by a content hash of their inputs, so stale entries are never
+  // read; they simply stop being looked up.
+
+  // 64-bit FNV-1a hash of a byte range. Pass the previous result as the
+  // seed to hash several ranges.
+  uint64_t hash_bytes(const void* data, size_t bytes,
+      uint64_t seed = 14695981039346656037ull);
+
+  template <typename Derived>
+  uint64_t hash_matrix(const Eigen::PlainObjectBase<Derived>& A,
+      uint64_t seed = 14695981039346656037ull) {
+    int64_t dims[2] = {A.rows(), A.cols()};
+    seed = hash_bytes(dims, sizeof(dims), seed);
+    return hash_bytes(A.data(), sizeof(typename Derived::Scalar) * A.size(),
+        seed);
+  }
+
+  // Path of a cache file within a directory
+  // dir    - cache directory
+  // prefix - type of cached data
+  // key    - content hash
+  std::string cache_path(const std::string& dir, const std::string& prefix,
+      uint64_t key);
+
+  // Writes a cache file as a sequence of length-prefixed arrays. Data is
+  // written to a temporary file that is moved into place by commit(), so a
+  // partially written cache is never visible to readers.
+  class CacheWriter {
+  public:
+
+    CacheWriter(const std::string& path, uint64_t key);
+    ~CacheWriter();
+
+    bool good() const { return file_ != nullptr; }
+
+    // Finish writing and move the file into place. Returns false on error.
+    bool commit();
+
+    template <typename T>
+    void write(const T* data, uint64_t n) {
+      write_bytes(&n, sizeof(n));
+      write_bytes(data, sizeof(T) * n);
+    }
+
+    template <typename T>
+    void write(const std::vector<T>& v) {
+      write(v.data(), v.size());
+    }
+
+    template <typename Scalar>
+    void write(const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>& A)
+    {
+      int64_t dims[2] = {A.rows(), A.cols()};
+      write(dims, 2);
+      write(A.data(), A.size());
+    }
+
+    void write(const Eigen::VectorXd& a);
+    void write(const ElementBlocks<double>& A);
+
+    template <int Options>
+    void write(const Eigen::SparseMatrix<double, Options>& A) {
+      Eigen::SparseMatrix<double, Options> tmp;
+      const Eigen::SparseMatrix<double, Options>* ptr = &A;
+      if (!A.isCompressed()) {
+        tmp = A;
+        tmp.makeCompressed();
+        ptr = &tmp;
+      }
+      int64_t dims[2] = {ptr->rows(), ptr->cols()};
+      write(dims, 2);
+      write(ptr->outerIndexPtr(), ptr->outerSize() + 1);
+      write(ptr->innerIndexPtr(), ptr->nonZeros());
+      write(ptr->valuePtr(), ptr->nonZeros());
+    }
+
+  private:
+    void write_bytes(const void* data, size_t bytes);
+
+    std::string path_;
+    std::string tmp_path_;
+    FILE* file_;
+  };
+
+  // Reads a cache file written by CacheWriter by memory-mapping it. Arrays
+  // are read in the order they were written. good() is false if the file is
+  // missing, has a different key/format, or a read runs past the end.
+  class CacheReader {
+  public:
+
+    CacheReader(const std::string& path, uint64_t key);
+    ~CacheReader();
+
+    CacheReader(const CacheReader&) = delete;
+    CacheReader& operator=(const CacheReader&) = delete;
+
+    bool good() const { return good_; }
+
+    // Returns a pointer into the mapped file and its length, or nullptr on
+    // failure. Valid until the reader is destroyed.
+    template <typename T>
+    const T* read(uint64_t& n) {
+      const uint64_t* len = static_cast<const uint64_t*>(
+          read_bytes(sizeof(uint64_t)));
+      if (len == nullptr) {
+        return nullptr;
+      }
+      n = *len;
+      // n comes from the file, so check it before sizeof(T) * n can
+      // overflow
+      if (n > (size_ - pos_) / sizeof(T)) {
+        fail();
+        return nullptr;
+      }
+      return static_cast<const T*>(read_bytes(sizeof(T) * n));
+    }
+
+    template <typename T>
+    bool read(std::vector<T>& v) {
+      uint64_t n;
+      const T* data = read<T>(n);
+      if (data == nullptr) return false;
+      v.assign(data, data + n);
+      return true;
+    }
+
+    template <typename Scalar>
+    bool read(Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>& A) {
+      using MatX = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+      uint64_t n, m;
+      const int64_t* dims = read<int64_t>(n);
+      if (dims == nullptr || n != 2 || dims[0] < 0 || dims[1] < 0) {
+        return fail();
+      }
+      const Scalar* data = read<Scalar>(m);
+      if (data == nullptr || m != static_cast<uint64_t>(dims[0]*dims[1])) {
+        return fail();
+      }
+      A = Eigen::Map<const MatX>(data, dims[0], dims[1]);
+      return true;
+    }
+
+    bool read(Eigen::VectorXd& a);
+    bool read(ElementBlocks<double>& A);
+
+    // The compressed structure is validated before it is used, so a
+    // corrupt file is a cache miss rather than an out of bounds access
+    template <int Options>
+    bool read(Eigen::SparseMatrix<double, Options>& A) {
+      uint64_t n, nouter, ninner, nvalues;
+      const int64_t* dims = read<int64_t>(n);
+      if (dims == nullptr || n != 2 || dims[0] < 0 || dims[1] < 0
+          || dims[0] > INT_MAX || dims[1] > INT_MAX) {
+        return fail();
+      }
+      const int* outer = read<int>(nouter);
+      const int* inner = read<int>(ninner);
+      const double* values = read<double>(nvalues);
+      if (outer == nullptr || inner == nullptr || values == nullptr
+          || ninner != nvalues) {
+        return fail();
+      }
+
+      const bool row_major = (Options & Eigen::RowMajor) != 0;
+      const int64_t outer_size = row_major ? dims[0] : dims[1];
+      const int64_t inner_size = row_major ? dims[1] : dims[0];
+      if (nouter != static_cast<uint64_t>(outer_size + 1) || outer[0] != 0
+          || static_cast<uint64_t>(outer[outer_size]) != ninner) {
+        return fail();
+      }
+      for (int64_t i = 0; i < outer_size; ++i) {
+        if (outer[i] > outer[i + 1]) {
+          return fail();
+        }
+      }
+      for (uint64_t i = 0; i < ninner; ++i) {
+        if (inner[i] < 0 || inner[i] >= inner_size) {
+          return fail();
+        }
+      }
+
+      A = Eigen::Map<const Eigen::SparseMatrix<double, Options>>(dims[0],
+          dims[1], ninner, outer, inner, values);
+      return true;
+    }
+
+  private:
+    const void* read_bytes(size_t bytes);
+
+    bool fail() {
+      good_ = false;
+      return false;
+    }
+
+    bool good_;
+    const char* data_;
+    size_t size_;
+    size_t pos_;
+  };
+
+}
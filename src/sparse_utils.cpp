@@ -1,307 +1,502 @@
 #include "sparse_utils.h"
+#include <cstdint>
 
 using namespace mfem;
 using namespace Eigen;
 
-namespace {
-  template<typename T>
-  void reorder(std::vector<T>& val, const std::vector<int>& indices) {
-    std::vector<T> tmp(indices.size());
-
-    for (size_t i = 0; i < indices.size(); ++i) {
-      tmp[i] = val[indices[i]];
-      //tmp[indices[i]] = val[i];
-    }
-    std::copy(tmp.begin(), tmp.end(), val.begin());
-  }
-}
-
 template <typename Scalar, int DIM, int N>
 Assembler<Scalar,DIM,N>::Assembler(const MatrixXi& E,
-    const std::vector<int>& free_map) {
+    const std::vector<int>& free_map, bool upper) : upper_(upper) {
 
   if (N != -1) {
     assert(N == E.cols());
   }
 
   int N_ = E.cols();
+  int nelem = E.rows();
+  block_size_ = DIM * N_;
 
-  element_ids.reserve(N_*N_*E.rows());
-  global_pairs.reserve(N_*N_*E.rows());
-  local_pairs.reserve(N_*N_*E.rows());
-
-  int cur_id = 0;
-  std::vector<int> ids;
-  ids.reserve(N_*N_*E.rows());
-
-  int cols = E.cols();
-  // Identify all node pairs for each element
-  for (int i = 0; i < E.rows(); ++i) {
-    for (int j = 0; j < cols; ++j) {
+  // Identify all free node pairs for each element and initialize the
+  // sparsity pattern of the matrix. Duplicate pairs are merged by
+  // setFromTriplets.
+  std::vector<Triplet<Scalar>> trips;
+  trips.reserve(DIM*DIM*N_*N_*nelem);
+  for (int i = 0; i < nelem; ++i) {
+    for (int j = 0; j < N_; ++j) {
       int id1 = free_map[E(i,j)];
-      for (int k = 0; k < cols; ++k) {
+      for (int k = 0; k < N_; ++k) {
         int id2 = free_map[E(i,k)];
 
         // If both nodes are unpinned, insert the pair
         if (id1 != -1 && id2 != -1) {
-          element_ids.push_back(i);
-          global_pairs.push_back(std::make_pair(id1,id2));
-          local_pairs.push_back(std::make_pair(j,k));
-          ids.push_back(cur_id++);
+          for (int l = 0; l < DIM; ++l) {
+            for (int m = 0; m < DIM; ++m) {
+              int row = id1*DIM+l;
+              int col = id2*DIM+m;
+              if (!upper_ || row <= col) {
+                trips.push_back(Triplet<Scalar>(row, col, 1.0));
+              }
+            }
+          }
         }
       }
     }
   }
 
-  // Sort the pairs so that they are in row major ordering
-  auto sorter = [&](int i, int j)->bool {
-    return global_pairs[i].first < global_pairs[j].first ||
-            (global_pairs[i].first == global_pairs[j].first 
-            && global_pairs[i].second < global_pairs[j].second);
-  };
-  //std::cout << "ids: ";
-  //for(int i= 0; i < ids.size();++i) { std::cout << ids[i] << ", ";}std::cout << std::endl;
-  std::sort(ids.begin(), ids.end(), sorter);
-  reorder(global_pairs, ids);
-  reorder(element_ids, ids);
-  reorder(local_pairs, ids);
-
-  //std::cout << "ids: ";
-  //for(int i= 0; i < ids.size();++i) { std::cout << ids[i] << ", ";
-  //  std::cout << " global: " << global_pairs[i].first << ", " << global_pairs[i].second << " " << element_ids[i] << std::endl;
-  //}std::cout << std::endl;
-
-  // Identify multiplicity of each pair
-  multiplicity.resize(element_ids.size(),1);
-
-  int i = 0;
-  int npairs = 0;
-  int curr_row = 0;
-  std::pair<int, int> curr_pair;
-
-  row_offsets.push_back(curr_row);
-  num_nodes = 0;
-
-  // Loop over pairs, counting duplicates
-  // Purpose of this is so that we can easily sum over duplicate
-  // entries when assembling the matrix
-  while (i < multiplicity.size()) {
-      //&& (i + multiplicity[i]) < multiplicity.size()) {
-
-    curr_pair = global_pairs[i];
-
-    // Mark the offset in which we meet a new row
-    if (curr_pair.first != curr_row) {
-      row_offsets.push_back(i);
-      curr_row = curr_pair.first;
-    }
-
-    // Check if duplicate global pair and increase multiplicity if so
-    while ((i+multiplicity[i]) < multiplicity.size()
-        && curr_pair == global_pairs[i + multiplicity[i]]) {
-      ++multiplicity[i];
-    }
+  int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
+  A.resize(DIM*m, DIM*m);
+  A.setFromTriplets(trips.begin(), trips.end());
+  A.makeCompressed();
 
-    offsets.push_back(i);
-    i += multiplicity[i];
-    ++num_nodes;
-  }
-  row_offsets.push_back(multiplicity.size());
+  // For each element block entry, find its position in the CSR value array
+  int MM = block_size_ * block_size_;
+  value_map.resize(MM * nelem);
 
-  // Initialize our sparse matrix
-  std::vector<Triplet<Scalar>> trips;
-  for (int i = 0; i < num_nodes; ++i) {
-    std::pair<int,int>& p = global_pairs[offsets[i]];
-    // std::cout << "i: " << i << " offset: " << offsets[i] << " pair: " << p.first << ", " << p.second << std::endl;
-    for (int j = 0; j < DIM; ++j) {
-      for (int k = 0; k < DIM; ++k) {
-        trips.push_back(Triplet<double>(
-              p.first*DIM+j, p.second*DIM+k,1.0));
+  const int* outer = A.outerIndexPtr();
+  const int* inner = A.innerIndexPtr();
 
+  #pragma omp parallel for
+  for (int i = 0; i < nelem; ++i) {
+    for (int j = 0; j < block_size_; ++j) {     // block column
+      int id2 = free_map[E(i,j/DIM)];
+      int col = DIM*id2 + j%DIM;
+
+      for (int k = 0; k < block_size_; ++k) {   // block row
+        int id1 = free_map[E(i,k/DIM)];
+        int idx = -1;
+
+        if (id1 != -1 && id2 != -1
+            && (!upper_ || DIM*id1 + k%DIM <= col)) {
+          int row = DIM*id1 + k%DIM;
+          const int* it = std::lower_bound(inner + outer[row],
+              inner + outer[row+1], col);
+          idx = it - inner;
+        }
+        value_map[MM*i + block_size_*j + k] = idx;
       }
     }
   }
 
-  int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
-  A.resize(DIM*m, DIM*m);
-  A.setFromTriplets(trips.begin(), trips.end());
-  // std::cout << "A\n" << A << std::endl;
+  // Invert the map so that the entries contributing to each nonzero are
+  // contiguous. Ids are visited in increasing order, so each nonzero
+  // sums its contributions in a fixed order.
+  src_offsets.assign(A.nonZeros() + 1, 0);
+  for (size_t i = 0; i < value_map.size(); ++i) {
+    if (value_map[i] != -1) {
+      ++src_offsets[value_map[i] + 1];
+    }
+  }
+  for (int i = 0; i < A.nonZeros(); ++i) {
+    src_offsets[i+1] += src_offsets[i];
+  }
+
+  src_ids.resize(src_offsets.back());
+  std::vector<int> fill(src_offsets.begin(), src_offsets.end() - 1);
+  for (size_t i = 0; i < value_map.size(); ++i) {
+    if (value_map[i] != -1) {
+      src_ids[fill[value_map[i]]++] = i;
+    }
+  }
 }
 
- 
 template <typename Scalar, int DIM, int N>
 void Assembler<Scalar,DIM,N>::update_matrix(const std::vector<MatM>& blocks)
 {
-  // Iterate over M rows at a time
+  // Fixed size blocks are stored contiguously by the vector
+  if constexpr (N != -1) {
+    update_matrix(blocks.empty() ? nullptr : blocks[0].data());
+    return;
+  }
+
+  // Dynamic blocks are separate allocations. Pack them so the gather
+  // indexes the flat block table directly instead of splitting each id
+  // into element and entry.
+  const int nelem = blocks.size();
+  packed_.resize(nelem, block_size_, block_size_);
+  #pragma omp parallel for
+  for (int i = 0; i < nelem; ++i) {
+    packed_.block(i) = blocks[i];
+  }
+  update_matrix(packed_.data());
+}
+
+template <typename Scalar, int DIM, int N>
+void Assembler<Scalar,DIM,N>::update_matrix(
+    const ElementBlocks<Scalar>& blocks) {
+  assert(blocks.rows() == block_size_ && blocks.cols() == block_size_);
+  update_matrix(blocks.data());
+}
+
+template <typename Scalar, int DIM, int N>
+void Assembler<Scalar,DIM,N>::update_matrix(const Scalar* blocks) {
+  // Each nonzero gathers its (contiguous) list of contributing entries,
+  // so no two threads write to the same value.
+  const int nnz = A.nonZeros();
+  const int* offsets = src_offsets.data();
+  const int* ids = src_ids.data();
+  Scalar* values = A.valuePtr();
+
   #pragma omp parallel for
-  for (size_t ii = 0; ii < row_offsets.size() - 1; ++ii) {
-    int row_beg = row_offsets[ii];
-    int row_end = row_offsets[ii+1];
-
-    // std::cout << "non zeros: " << A.nonZeros() << std::endl;
-    // std::cout << "row beg: " << row_beg << " k_start: " << A.outerIndexPtr()[3*ii] << std::endl;;
-    // std::cout << "row end: " << row_end << std::endl;
-    // The index of the block for this row. 
-    int block_col = 0;
-
-    while (row_beg < row_end) {
-      // Get number of duplicate blocks for this offset
-      int n = multiplicity[row_beg];
-      // std::cout << "n: " << n << " block col: " << block_col << std::endl;
-
-      // Get the global positioning of this block
-      const std::pair<int,int>& g = global_pairs[row_beg];
-      // std::cout << "g: " << g.first << ", " << g.second << std::endl;
-
-      // Compute Local block
-      Matrix<double,DIM,DIM> local_block;
-      local_block.setZero();
-      for (int i = 0; i < n; ++i) {
-
-        int e = element_ids[row_beg + i];
-
-        // Local coordinates within element's block
-        const std::pair<int,int>& l = local_pairs[row_beg + i];
-        local_block += blocks[e].block(DIM*l.first, DIM*l.second, DIM, DIM);
+  for (int k = 0; k < nnz; ++k) {
+    Scalar val = 0;
+    for (int i = offsets[k]; i < offsets[k+1]; ++i) {
+      val += blocks[ids[i]];
+    }
+    values[k] = val;
+  }
+}
+
+template <typename Scalar, int DIM, int N>
+BSRAssembler<Scalar,DIM,N>::BSRAssembler(const MatrixXi& E,
+    const std::vector<int>& free_map) : N_(E.cols()) {
+
+  if (N != -1) {
+    assert(N == E.cols());
+  }
+
+  int nelem = E.rows();
+  int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
+
+  // Block columns coupled to each free node
+  std::vector<std::vector<int>> cols(m);
+  for (int i = 0; i < nelem; ++i) {
+    for (int j = 0; j < N_; ++j) {
+      int id1 = free_map[E(i,j)];
+      if (id1 == -1) continue;
+      for (int k = 0; k < N_; ++k) {
+        int id2 = free_map[E(i,k)];
+        if (id2 != -1) {
+          cols[id1].push_back(id2);
+        }
       }
+    }
+  }
 
-      // Apologies to the cache locality gods
-      // For each row of the DIMxDIM blocks
-      for (int i = 0; i < DIM; ++i) {
-        // Find the corresponding column position for this block
-        int start = A.outerIndexPtr()[DIM*ii + i] + DIM*block_col;
-        // std::cout << "\t start : " << i << " start : " << start << std::endl;
-        for (int j = 0; j < DIM; ++j) {
-          // Assign the value
-          int idx = start + j;
-          A.valuePtr()[idx] = local_block(i,j);
+  #pragma omp parallel for
+  for (int i = 0; i < m; ++i) {
+    std::sort(cols[i].begin(), cols[i].end());
+    cols[i].erase(std::unique(cols[i].begin(), cols[i].end()), cols[i].end());
+  }
+
+  std::vector<int> outer(m + 1, 0);
+  for (int i = 0; i < m; ++i) {
+    outer[i+1] = outer[i] + cols[i].size();
+  }
+  std::vector<int> inner;
+  inner.reserve(outer[m]);
+  for (int i = 0; i < m; ++i) {
+    inner.insert(inner.end(), cols[i].begin(), cols[i].end());
+  }
+  A = BSRMatrix<Scalar,DIM>(m, m, outer, inner);
+
+  // Position of each element's local blocks in the block array
+  int NN = N_ * N_;
+  block_map.resize(NN * nelem);
+
+  #pragma omp parallel for
+  for (int i = 0; i < nelem; ++i) {
+    for (int k = 0; k < N_; ++k) {
+      int id2 = free_map[E(i,k)];
+      for (int j = 0; j < N_; ++j) {
+        int id1 = free_map[E(i,j)];
+        int idx = -1;
+        if (id1 != -1 && id2 != -1) {
+          const int* it = std::lower_bound(inner.data() + outer[id1],
+              inner.data() + outer[id1+1], id2);
+          idx = it - inner.data();
         }
+        block_map[NN*i + N_*k + j] = idx;
       }
-      
-      // Move to next sequence of duplicate blocks
-      row_beg += n;
-      ++block_col;
     }
+  }
+
+  // Invert the map so each stored block's contributions are contiguous
+  int nnzb = inner.size();
+  src_offsets.assign(nnzb + 1, 0);
+  for (size_t i = 0; i < block_map.size(); ++i) {
+    if (block_map[i] != -1) {
+      ++src_offsets[block_map[i] + 1];
+    }
+  }
+  for (int i = 0; i < nnzb; ++i) {
+    src_offsets[i+1] += src_offsets[i];
+  }
 
+  src_ids.resize(src_offsets.back());
+  std::vector<int> fill(src_offsets.begin(), src_offsets.end() - 1);
+  for (size_t i = 0; i < block_map.size(); ++i) {
+    if (block_map[i] != -1) {
+      src_ids[fill[block_map[i]]++] = i;
+    }
+  }
+}
+
+template <typename Scalar, int DIM, int N>
+void BSRAssembler<Scalar,DIM,N>::update_matrix(
+    const std::vector<MatM>& blocks) {
+  update_blocks([&](int e) { return blocks[e].data(); });
+}
+
+template <typename Scalar, int DIM, int N>
+void BSRAssembler<Scalar,DIM,N>::update_matrix(
+    const ElementBlocks<Scalar>& blocks) {
+  assert(blocks.rows() == DIM*N_ && blocks.cols() == DIM*N_);
+  const size_t MM = blocks.rows() * blocks.cols();
+  const Scalar* data = blocks.data();
+  update_blocks([&](int e) { return data + e * MM; });
+}
+
+template <typename Scalar, int DIM, int N>
+template <typename F>
+void BSRAssembler<Scalar,DIM,N>::update_blocks(const F& element_block) {
+  using SubBlock = Map<const Matrix<Scalar,DIM,DIM>, 0, OuterStride<>>;
+  const int NN = N_ * N_;
+  const int M = DIM * N_;
+  const int nnzb = A.non_zero_blocks();
+
+  #pragma omp parallel for
+  for (int b = 0; b < nnzb; ++b) {
+    Matrix<Scalar,DIM,DIM> sum = Matrix<Scalar,DIM,DIM>::Zero();
+    for (int i = src_offsets[b]; i < src_offsets[b+1]; ++i) {
+      int id = src_ids[i];
+      int e = id / NN;
+      int j = (id % NN) % N_;
+      int k = (id % NN) / N_;
+      sum += SubBlock(element_block(e) + DIM*k*M + DIM*j, OuterStride<>(M));
+    }
+    A.block(b) = sum;
   }
 }
 
 template <typename Scalar, int DIM, int N>
 VecAssembler<Scalar,DIM,N>::VecAssembler(const MatrixXi& E,
-    const std::vector<int>& free_map) {
+    const std::vector<int>& free_map, bool colored)
+    : nelem_(E.rows()), N_(E.cols()), colored_(colored) {
   if (N != -1) {
     assert(N == E.cols());
   }
 
-  int N_ = E.cols();
-element_ids.reserve(N_*E.rows());
-  global_vids.reserve(N_*E.rows());
-  local_vids.reserve(N_*E.rows());
-
-  int cur_id = 0;
-  std::vector<int> ids;
-  ids.reserve(N_*N_*E.rows());
-
-  int cols = E.cols();
-  // Identify all free nodes for each element
-  for (int i = 0; i < E.rows(); ++i) {
-    for (int j = 0; j < cols; ++j) {
+  int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
+  size_ = DIM * m;
+
+  free_ids_.resize(nelem_*N_);
+  node_offsets_.assign(m+1, 0);
+
+  // Free node ids for each element and the number of elements
+  // incident on each node.
+  #pragma omp parallel for
+  for (int i = 0; i < nelem_; ++i) {
+    for (int j = 0; j < N_; ++j) {
       int id = free_map[E(i,j)];
-      // If both nodes are unpinned, insert the pair
+      free_ids_[N_*i + j] = id;
       if (id != -1) {
-        element_ids.push_back(i);
-        local_vids.push_back(j);
-        global_vids.push_back(id);
-        ids.push_back(cur_id++);
+        #pragma omp atomic
+        ++node_offsets_[id+1];
       }
     }
   }
 
-  // Sorter for ids
-  auto sorter = [&](int i, int j)->bool {
-    return global_vids[i] < global_vids[j];
-  };
+  for (int i = 0; i < m; ++i) {
+    node_offsets_[i+1] += node_offsets_[i];
+  }
 
-  std::sort(ids.begin(), ids.end(), sorter);
-  reorder(global_vids, ids);
-  reorder(local_vids, ids);
-  reorder(element_ids, ids);
+  // Scatter (element, local id) pairs into each node's range
+  node_elements_.resize(node_offsets_[m]);
+  node_locals_.resize(node_offsets_[m]);
+  std::vector<int> fill(node_offsets_.begin(), node_offsets_.end()-1);
+
+  #pragma omp parallel for
+  for (int i = 0; i < nelem_; ++i) {
+    for (int j = 0; j < N_; ++j) {
+      int id = free_ids_[N_*i + j];
+      if (id != -1) {
+        int pos;
+        #pragma omp atomic capture
+        pos = fill[id]++;
+        node_elements_[pos] = i;
+        node_locals_[pos] = j;
+      }
+    }
+  }
+
+  // The scatter above is unordered, so sort each node's range by element
+  // to keep the summation order deterministic.
+  #pragma omp parallel for
+  for (int i = 0; i < m; ++i) {
+    int beg = node_offsets_[i];
+    int end = node_offsets_[i+1];
+    for (int j = beg + 1; j < end; ++j) {
+      int e = node_elements_[j];
+      int l = node_locals_[j];
+      int k = j - 1;
+      while (k >= beg && node_elements_[k] > e) {
+        node_elements_[k+1] = node_elements_[k];
+        node_locals_[k+1] = node_locals_[k];
+        --k;
+      }
+      node_elements_[k+1] = e;
+      node_locals_[k+1] = l;
+    }
+  }
 
-  // Identify multiplicity of each pair
-  multiplicity.resize(element_ids.size(),1);
+  if (colored_) {
+    compute_coloring();
+  }
+}
 
-  int i = 0;
-  int npairs = 0;
-  int curr_row = 0;
-  int curr_vid;
+template <typename Scalar, int DIM, int N>
+void VecAssembler<Scalar,DIM,N>::compute_coloring() {
 
-  row_offsets.push_back(curr_row);
-  num_nodes = 0;
+  // Random priorities break ties between neighboring elements
+  auto priority = [](uint32_t x)->uint32_t {
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    return (x >> 16) ^ x;
+  };
+  auto precedes = [&](int e, int f)->bool {
+    uint32_t pe = priority(e);
+    uint32_t pf = priority(f);
+    return pe < pf || (pe == pf && e < f);
+  };
 
-  // Loop over vertex ids (vids), counting duplicates
-  // Purpose of this is so that we can easily sum over duplicate
-  // entries when assembling the vector
-  while (i < multiplicity.size()) {
+  std::vector<int> colors(nelem_, -1);
+  std::vector<char> selected(nelem_, 0);
+  int remaining = nelem_;
 
-    curr_vid = global_vids[i];
+  while (remaining > 0) {
 
-    // Mark the offset in which we meet a new row
-    if (curr_vid != curr_row) {
-      row_offsets.push_back(i);
-      curr_row = curr_vid;
+    // An uncolored element is selected if it has the highest priority among
+    // its uncolored neighbors. Selected elements are never adjacent.
+    #pragma omp parallel for
+    for (int e = 0; e < nelem_; ++e) {
+      selected[e] = 0;
+      if (colors[e] != -1) {
+        continue;
+      }
+      bool is_max = true;
+      for (int j = 0; j < N_ && is_max; ++j) {
+        int id = free_ids_[N_*e + j];
+        if (id == -1) continue;
+        for (int k = node_offsets_[id]; k < node_offsets_[id+1]; ++k) {
+          int f = node_elements_[k];
+          if (f != e && colors[f] == -1 && precedes(e, f)) {
+            is_max = false;
+            break;
+          }
+        }
+      }
+      selected[e] = is_max;
     }
 
-    // Check if duplicate global id and increase multiplicity if so
-    while ((i+multiplicity[i]) < multiplicity.size()
-        && curr_vid == global_vids[i + multiplicity[i]]) {
-      ++multiplicity[i];
+    // Assign each selected element the smallest color unused by its
+    // neighbors.
+    #pragma omp parallel for reduction(- : remaining)
+    for (int e = 0; e < nelem_; ++e) {
+      if (!selected[e]) {
+        continue;
+      }
+      std::vector<int> used;
+      for (int j = 0; j < N_; ++j) {
+        int id = free_ids_[N_*e + j];
+        if (id == -1) continue;
+        for (int k = node_offsets_[id]; k < node_offsets_[id+1]; ++k) {
+          int c = colors[node_elements_[k]];
+          if (c != -1) {
+            used.push_back(c);
+          }
+        }
+      }
+      std::sort(used.begin(), used.end());
+      int c = 0;
+      for (int u : used) {
+        if (u == c) {
+          ++c;
+        } else if (u > c) {
+          break;
+        }
+      }
+      colors[e] = c;
+      --remaining;
     }
+  }
 
-    offsets.push_back(i);
-    i += multiplicity[i];
-    ++num_nodes;
+  // Bucket elements by color
+  int ncolors = nelem_ > 0
+      ? *std::max_element(colors.begin(), colors.end()) + 1 : 0;
+  color_offsets.assign(ncolors+1, 0);
+  for (int e = 0; e < nelem_; ++e) {
+    ++color_offsets[colors[e]+1];
+  }
+  for (int c = 0; c < ncolors; ++c) {
+    color_offsets[c+1] += color_offsets[c];
+  }
+  color_elements.resize(nelem_);
+  std::vector<int> fill(color_offsets.begin(), color_offsets.end()-1);
+  for (int e = 0; e < nelem_; ++e) {
+    color_elements[fill[colors[e]]++] = e;
   }
-  row_offsets.push_back(multiplicity.size());
-  int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
-  size_ = DIM * m;
 }
 
 template <typename Scalar, int DIM, int N>
 void VecAssembler<Scalar,DIM,N>::assemble(
     const std::vector<Matrix<Scalar,M(),1>>& vecs, VectorXd& a) {
-  a.resize(size_);
-
-  // Iterate over M rows at a time
-  #pragma omp parallel for
-  for (size_t ii = 0; ii < row_offsets.size() - 1; ++ii) {
-    int row_beg = row_offsets[ii];
-    int row_end = row_offsets[ii+1];
-
-    // The index of the block for this row. 
-    int block_col = 0;
+  assemble_impl([&](int e) { return vecs[e].data(); }, a);
+}
 
-    while (row_beg < row_end) {
-      // Get number of duplicate blocks for this offset
-      int n = multiplicity[row_beg];
+template <typename Scalar, int DIM, int N>
+void VecAssembler<Scalar,DIM,N>::assemble(const ElementBlocks<Scalar>& vecs,
+    VectorXd& a) {
+  assert(vecs.rows() * vecs.cols() == DIM * N_);
+  assemble(vecs.data(), a);
+}
 
-      // Compute Local block
-      Matrix<Scalar,DIM,1> local_vec;
-      local_vec.setZero();
+template <typename Scalar, int DIM, int N>
+void VecAssembler<Scalar,DIM,N>::assemble(const Scalar* vecs, VectorXd& a) {
+  const int size = DIM * N_;
+  assemble_impl([&](int e) { return vecs + size*e; }, a);
+}
 
-      for (int i = 0; i < n; ++i) {
-        int e = element_ids[row_beg + i];
+template <typename Scalar, int DIM, int N>
+template <typename Func>
+void VecAssembler<Scalar,DIM,N>::assemble_impl(const Func& vec,
+    VectorXd& a) {
+  using VecD = Matrix<Scalar,DIM,1>;
+  a.resize(size_);
 
-        // Local coordinates within element's vector
-        int l = local_vids[row_beg + i];
-        local_vec += vecs[e].template segment<DIM>(DIM*l);
+  if (colored_) {
+    a.setZero();
+
+    // Elements within a color share no free nodes, so each color is
+    // scattered in parallel without atomics.
+    for (int c = 0; c < num_colors(); ++c) {
+      #pragma omp parallel for
+      for (int i = color_offsets[c]; i < color_offsets[c+1]; ++i) {
+        int e = color_elements[i];
+        const Scalar* ve = vec(e);
+        for (int j = 0; j < N_; ++j) {
+          int id = free_ids_[N_*e + j];
+          if (id != -1) {
+            a.segment<DIM>(DIM*id) += Map<const VecD>(ve + DIM*j);
+          }
+        }
       }
+    }
+    return;
+  }
 
-      a.segment<DIM>(DIM*ii) = local_vec;
-      
-      // Move to next sequence of duplicate blocks
-      row_beg += n;
-      ++block_col;
+  // Gather the contributions for each node
+  int m = node_offsets_.size() - 1;
+  #pragma omp parallel for
+  for (int i = 0; i < m; ++i) {
+    VecD local_vec;
+    local_vec.setZero();
+
+    for (int k = node_offsets_[i]; k < node_offsets_[i+1]; ++k) {
+      int e = node_elements_[k];
+      int l = node_locals_[k];
+      local_vec += Map<const VecD>(vec(e) + DIM*l);
     }
+    a.segment<DIM>(DIM*i) = local_vec;
   }
 }
 
@@ -311,6 +506,14 @@ template class mfem::Assembler<double, 3, 4>;
 template class mfem::Assembler<double, 3, 3>;
 template class mfem::Assembler<double, 2, 3>;
 template class mfem::Assembler<double, 2, Eigen::Dynamic>;
+template class mfem::Assembler<float, 3, Eigen::Dynamic>;
+template class mfem::Assembler<float, 2, Eigen::Dynamic>;
+
+template class mfem::BSRAssembler<double, 3, Eigen::Dynamic>;
+template class mfem::BSRAssembler<double, 3, 4>;
+template class mfem::BSRAssembler<double, 3, 3>;
+template class mfem::BSRAssembler<double, 2, 3>;
+template class mfem::BSRAssembler<double, 2, Eigen::Dynamic>;
 
 template class mfem::VecAssembler<double, 3, Eigen::Dynamic>;
 template class mfem::VecAssembler<double, 3, 4>;
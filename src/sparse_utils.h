@@ -1,6 +1,8 @@
 #pragma once
 
 #include <EigenTypes.h>
+#include "bsr_matrix.h"
+#include "element_blocks.h"
 
 namespace mfem {
 
@@ -13,17 +15,6 @@ namespace mfem {
 
   private:
 
-    template<typename T>
-    static void reorder(std::vector<T>& val, const std::vector<int>& indices) {
-      std::vector<T> tmp(indices.size());
-
-      for (size_t i = 0; i < indices.size(); ++i) {
-        tmp[i] = val[indices[i]];
-        //tmp[indices[i]] = val[i];
-      }
-      std::copy(tmp.begin(), tmp.end(), val.begin());
-    }
-
     // Returns the size of the local blocks for assembly. If N is dynamic
     // M() returns -1
     static constexpr int M() {
@@ -42,26 +33,95 @@ namespace mfem {
     // E        - elements nelem x 4 for tetrahedra
     // free_map - |nnodes| maps node to its position in unpinned vector
     //            equals -1 if node is pinned
-    Assembler(const Eigen::MatrixXi& E, const std::vector<int>& free_map);
-
-    
+    // upper    - if true, only the upper triangle of the (symmetric)
+    //            assembled matrix is stored
+    Assembler(const Eigen::MatrixXi& E, const std::vector<int>& free_map,
+        bool upper = false);
 
     // Update entries of matrix using per-element blocks
     // blocks   - |nelem| N*DIM x N*DIM blocks to update assembly matrix
     void update_matrix(const std::vector<MatM>& blocks);
+    void update_matrix(const ElementBlocks<Scalar>& blocks);
+
+    // Update entries of matrix from contiguous per-element blocks
+    // blocks   - |nelem| * (N*DIM)^2 values, each block column-major
+    void update_matrix(const Scalar* blocks);
+
+    // Flat table mapping each entry of each element's block to its index
+    // in A.valuePtr(). Entry (i,j) of element e's block is stored at
+    // e*M*M + j*M + i (column-major, matching the block's storage).
+    // Equals -1 if the entry couples a pinned node or lies in the
+    // unstored lower triangle.
+    std::vector<int> value_map;
 
-    // Element IDs, global, and local coordinates. Each of these vectors
-    // is of the same size.
-    std::vector<int> element_ids;
-    std::vector<std::pair<int,int>> global_pairs;
-    std::vector<std::pair<int,int>> local_pairs;
+    // Inverse of value_map in CSR order. The entries summed into the k-th
+    // nonzero of A are src_ids[src_offsets[k]] ... src_ids[src_offsets[k+1]-1]
+    // where each id is an index into the flat element block table.
+    std::vector<int> src_offsets;
+    std::vector<int> src_ids;
 
-    int num_nodes; // number of unique pairs / blocks in matrix
-    std::vector<int> multiplicity; // number of pairs to sum over for a node
-    std::vector<int> row_offsets;
-    std::vector<int> offsets;
     Eigen::SparseMatrix<Scalar, Eigen::RowMajor> A;
 
+    // True if only the upper triangle of A is stored
+    bool is_upper() const {
+      return upper_;
+    }
+
+  private:
+    int block_size_; // rows/cols of each element's block (DIM * N)
+    bool upper_;
+    ElementBlocks<Scalar> packed_; // contiguous copy of dynamic size blocks
+  };
+
+  // Assembles per-element blocks into a block compressed row matrix of
+  // DIMxDIM blocks. Same interface as Assembler but only one column
+  // index is stored per node pair.
+  template <typename Scalar, int DIM, int N>
+  class BSRAssembler {
+
+  private:
+
+    static constexpr int M() {
+      if (N == -1) {
+        return -1;
+      } else {
+        return DIM * N;
+      }
+    }
+
+    using MatM  = Eigen::Matrix<Scalar, M(), M()>;
+
+  public:
+    // Initialize assembler / analyze block sparsity of system
+    // E        - elements nelem x 4 for tetrahedra
+    // free_map - |nnodes| maps node to its position in unpinned vector
+    //            equals -1 if node is pinned
+    BSRAssembler(const Eigen::MatrixXi& E, const std::vector<int>& free_map);
+
+    // Update blocks of matrix using per-element blocks
+    // blocks   - |nelem| N*DIM x N*DIM blocks to update assembly matrix
+    void update_matrix(const std::vector<MatM>& blocks);
+    void update_matrix(const ElementBlocks<Scalar>& blocks);
+
+    // For each element e and local node pair (j,k), index of the
+    // stored block at e*N*N + k*N + j, or -1 if either node is pinned.
+    std::vector<int> block_map;
+
+    // Inverse of block_map. The local blocks summed into the k-th stored
+    // block are src_ids[src_offsets[k]] ... src_ids[src_offsets[k+1]-1]
+    std::vector<int> src_offsets;
+    std::vector<int> src_ids;
+
+    BSRMatrix<Scalar, DIM> A;
+
+  private:
+
+    // Sums the local blocks into A. element_block(e) returns a pointer to
+    // element e's column-major N*DIM x N*DIM block.
+    template <typename F>
+    void update_blocks(const F& element_block);
+
+    int N_; // nodes per element
   };
 
   // Class for parallel assembly of FEM vectors
@@ -73,12 +133,15 @@ namespace mfem {
   public:
 
     // Initialize assembler / analyze sparsity of system
-    // None of this wonderfully optimized since we only have to do it once
     // E        - elements nelem x 4 for tetrahedra
     // free_map - |nnodes| maps node to its position in unpinned vector
     //            equals -1 if node is pinned
+    // colored  - if true, elements are graph colored so that no two
+    //            elements in a color share a free node, and assemble()
+    //            scatters each color in parallel. Otherwise assemble()
+    //            gathers the contributions for each node in parallel.
     VecAssembler(const Eigen::MatrixXi& E,
-        const std::vector<int>& free_map);
+        const std::vector<int>& free_map, bool colored = false);
 
     // Returns the size of the local blocks for assembly. If N is dynamic
     // M() returns -1
@@ -94,20 +157,47 @@ namespace mfem {
     // vecs   - |nnodes|xN*M x 1
     void assemble(const std::vector<Eigen::Matrix<Scalar,M(),1>>& vecs,
         Eigen::VectorXd& a);
+    void assemble(const ElementBlocks<Scalar>& vecs, Eigen::VectorXd& a);
+
+    // Assemble contiguous local products into vector
+    // vecs   - |nelem| * N*DIM values
+    void assemble(const Scalar* vecs, Eigen::VectorXd& a);
+
+    // Number of colors used in colored mode (0 otherwise)
+    int num_colors() const {
+      return color_offsets.empty() ? 0 : color_offsets.size() - 1;
+    }
+
+    // Element IDs in each color. Elements of color c are
+    // color_elements[color_offsets[c]] ... color_elements[color_offsets[c+1]-1]
+    std::vector<int> color_offsets;
+    std::vector<int> color_elements;
+
   private:
 
+    // Greedy parallel (Jones-Plassmann) coloring of the elements
+    void compute_coloring();
 
-    // Element IDs, global, and local coordinates. Each of these vectors
-    // is of the same size.
-    std::vector<int> element_ids;
-    std::vector<int> global_vids;
-    std::vector<int> local_vids;
+    // Shared assembly routine. vec(e) returns a pointer to the
+    // DIM * N values of element e.
+    template <typename Func>
+    void assemble_impl(const Func& vec, Eigen::VectorXd& a);
 
-    int num_nodes; // number of unique pairs / blocks in matrix
+    int nelem_;    // number of elements
+    int N_;        // nodes per element
     int size_;     // size of the assembled vector
-    std::vector<int> multiplicity; // number of pairs to sum over for a node
-    std::vector<int> row_offsets;
-    std::vector<int> offsets;
+    bool colored_;
+
+    // For element e and local node j, the free node id or -1 if pinned
+    std::vector<int> free_ids_;
+
+    // Node to element incidence. For free node i, entries
+    // node_offsets_[i] ... node_offsets_[i+1]-1 of node_elements_ and
+    // node_locals_ hold the elements containing i and i's local index
+    // within each of them.
+    std::vector<int> node_offsets_;
+    std::vector<int> node_elements_;
+    std::vector<int> node_locals_;
   };
 
 
@@ -156,6 +246,121 @@ namespace mfem {
     mat.setFromTriplets(trips.begin(), trips.end());
   }
 
+  // Maintains the values of a block symmetric matrix of the form
+  // P = [A B^T; B C] where C is block diagonal. The sparsity pattern is
+  // built once with fill_block_matrix. Afterwards, for inputs with the same
+  // sparsity, update() copies values directly into P's nonzeros instead of
+  // rebuilding and sorting triplets.
+  template <int N, int AOrdering, int BOrdering, int POrdering>
+  class BlockMatrixAssembler {
+  public:
+
+    // Analyze sparsity and initialize mat
+    // A    - top left block
+    // B    - bottom left block (its transpose fills the top right)
+    // C    - |nblocks| NxN bottom right diagonal blocks
+    // mat  - output block matrix
+    BlockMatrixAssembler(const Eigen::SparseMatrix<double, AOrdering>& A,
+        const Eigen::SparseMatrix<double, BOrdering>& B,
+        const std::vector<Eigen::Matrix<double, N, N>>& C,
+        Eigen::SparseMatrix<double, POrdering>& mat) {
+
+      using namespace Eigen;
+      fill_block_matrix(A, B, C, mat);
+      mat.makeCompressed();
+
+      int offset = A.rows();
+
+      a_map_.reserve(A.nonZeros());
+      for (int i = 0; i < A.outerSize(); ++i) {
+        for (typename SparseMatrix<double,AOrdering>::InnerIterator it(A,i);
+            it; ++it) {
+          a_map_.push_back(value_index(mat, it.row(), it.col()));
+        }
+      }
+
+      b_map_.reserve(2*B.nonZeros());
+      for (int i = 0; i < B.outerSize(); ++i) {
+        for (typename SparseMatrix<double,BOrdering>::InnerIterator it(B,i);
+            it; ++it) {
+          b_map_.push_back(value_index(mat, offset+it.row(), it.col()));
+          b_map_.push_back(value_index(mat, it.col(), offset+it.row()));
+        }
+      }
+
+      c_map_.resize(N*N*C.size());
+      for (size_t i = 0; i < C.size(); ++i) {
+        int c_offset = offset + i * N;
+        for (int j = 0; j < N; ++j) {
+          for (int k = 0; k < N; ++k) {
+            c_map_[N*N*i + N*k + j] = value_index(mat, c_offset+j,
+                c_offset+k);
+          }
+        }
+      }
+    }
+
+    // Refresh the values of mat. A and B must be compressed and have
+    // the same sparsity as the matrices used during initialization.
+    template <typename DerivedA, typename DerivedB>
+    void update(const Eigen::SparseCompressedBase<DerivedA>& A,
+        const Eigen::SparseCompressedBase<DerivedB>& B,
+        const std::vector<Eigen::Matrix<double, N, N>>& C,
+        Eigen::SparseMatrix<double, POrdering>& mat) const {
+
+      assert(A.isCompressed() && A.nonZeros() == (int)a_map_.size());
+      assert(B.isCompressed() && 2*B.nonZeros() == (int)b_map_.size());
+      assert(N*N*C.size() == c_map_.size());
+
+      double* values = mat.valuePtr();
+      const double* a = A.valuePtr();
+      const double* b = B.valuePtr();
+      int na = a_map_.size();
+      int nb = b_map_.size() / 2;
+      int nc = C.size();
+
+      #pragma omp parallel
+      {
+        #pragma omp for nowait
+        for (int i = 0; i < na; ++i) {
+          values[a_map_[i]] = a[i];
+        }
+
+        #pragma omp for nowait
+        for (int i = 0; i < nb; ++i) {
+          values[b_map_[2*i]] = b[i];
+          values[b_map_[2*i+1]] = b[i];
+        }
+
+        #pragma omp for
+        for (int i = 0; i < nc; ++i) {
+          const double* c = C[i].data();
+          for (int j = 0; j < N*N; ++j) {
+            values[c_map_[N*N*i + j]] = c[j];
+          }
+        }
+      }
+    }
+
+  private:
+
+    // Position of entry (row, col) in mat.valuePtr()
+    static int value_index(const Eigen::SparseMatrix<double,POrdering>& mat,
+        int row, int col) {
+      int outer = (POrdering == Eigen::RowMajor) ? row : col;
+      int inner = (POrdering == Eigen::RowMajor) ? col : row;
+      const int* beg = mat.innerIndexPtr() + mat.outerIndexPtr()[outer];
+      const int* end = mat.innerIndexPtr() + mat.outerIndexPtr()[outer+1];
+      const int* it = std::lower_bound(beg, end, inner);
+      assert(it != end && *it == inner);
+      return it - mat.innerIndexPtr();
+    }
+
+    std::vector<int> a_map_; // value index in mat for each nonzero of A
+    std::vector<int> b_map_; // value indices for each nonzero of B and B^T
+    std::vector<int> c_map_; // value indices for each entry of C (col-major)
+  };
+
   // Builds a block symmetric matrix of the form
   // P = [A 0; 0 C] where C is block diagonal
   template <int N, int Ordering>
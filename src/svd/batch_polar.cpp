@@ -0,0 +1,279 @@
+#include "batch_polar.h"
+#include <cmath>
+
+using namespace mfem;
+
+namespace {
+
+  constexpr int W = BATCH_WIDTH;
+
+  // Rotation by angle t = |w| about w / t (Rodrigues' formula)
+  //   dR = I + sin(t)/t [w]x + (1 - cos(t))/t^2 [w]x^2
+  // with series expansions of the coefficients for small angles, so
+  // small Newton steps are not rounded to the identity. dR is
+  // column-major.
+  inline void rodrigues(double w0, double w1, double w2, double dR[9]) {
+    double t2 = w0*w0 + w1*w1 + w2*w2;
+    double t = std::sqrt(t2);
+    bool small = t2 < 1e-8;
+    double a = small ? 1.0 - t2/6.0 : std::sin(t) / t;
+    double b = small ? 0.5 - t2/24.0 : (1.0 - std::cos(t)) / t2;
+    dR[0] = 1.0 + b*(w0*w0 - t2);
+    dR[4] = 1.0 + b*(w1*w1 - t2);
+    dR[8] = 1.0 + b*(w2*w2 - t2);
+    dR[1] = b*w0*w1 + a*w2;
+    dR[3] = b*w0*w1 - a*w2;
+    dR[2] = b*w0*w2 - a*w1;
+    dR[6] = b*w0*w2 + a*w1;
+    dR[5] = b*w1*w2 + a*w0;
+    dR[7] = b*w1*w2 - a*w0;
+  }
+
+  // Adjugate and determinant of the symmetric matrix
+  //   [h0 h3 h4]
+  //   [h3 h1 h5]
+  //   [h4 h5 h2]
+  inline double adjugate(double h0, double h1, double h2, double h3,
+      double h4, double h5, double adj[6]) {
+    adj[0] = h1*h2 - h5*h5;
+    adj[1] = h0*h2 - h4*h4;
+    adj[2] = h0*h1 - h3*h3;
+    adj[3] = h4*h5 - h3*h2;
+    adj[4] = h3*h5 - h4*h1;
+    adj[5] = h3*h4 - h0*h5;
+    return h0*adj[0] + h3*adj[3] + h4*adj[4];
+  }
+
+}
+
+void mfem::batch_polar(const LaneMatrix<double,3,3>& F,
+    LaneMatrix<double,3,3>& R, LaneMatrix<double,6,1>& s,
+    LaneMatrix<double,6,9>* dsdF, double tol, int max_iter) {
+
+  // With Y = R * F^T, the procrustes energy for a rotation update
+  // exp([w]x) R is E(w) = -tr(exp([w]x) Y), which has the gradient and
+  // hessian (at w = 0)
+  //   g = [Y21 - Y12, Y02 - Y20, Y10 - Y01]
+  //   H = tr(Y) I - (Y + Y^T) / 2
+  LaneMatrix<double,3,3> Y, dR, tmp;
+  lane_multiply_transpose(R, F, Y);
+
+  alignas(64) double w[3][W];
+  alignas(64) double E0[W];
+  alignas(64) int search[W];
+
+  for (int iter = 0; iter < max_iter; ++iter) {
+
+    // Newton step on lanes that have not converged
+    int nactive = 0;
+    #pragma omp simd reduction(+ : nactive)
+    for (int l = 0; l < W; ++l) {
+      double g0 = Y(2,1)[l] - Y(1,2)[l];
+      double g1 = Y(0,2)[l] - Y(2,0)[l];
+      double g2 = Y(1,0)[l] - Y(0,1)[l];
+      double tr = Y(0,0)[l] + Y(1,1)[l] + Y(2,2)[l];
+      double adj[6];
+      double det = adjugate(tr - Y(0,0)[l], tr - Y(1,1)[l], tr - Y(2,2)[l],
+          -0.5*(Y(0,1)[l] + Y(1,0)[l]),
+          -0.5*(Y(0,2)[l] + Y(2,0)[l]),
+          -0.5*(Y(1,2)[l] + Y(2,1)[l]), adj);
+
+      bool active = g0*g0 + g1*g1 + g2*g2 >= tol*tol;
+      bool singular = std::abs(det) < 1e-12;
+      double inv_det = singular ? 0.0 : 1.0 / det;
+
+      // Fall back to gradient descent for singular hessians
+      double n0 = (adj[0]*g0 + adj[3]*g1 + adj[4]*g2) * inv_det;
+      double n1 = (adj[3]*g0 + adj[1]*g1 + adj[5]*g2) * inv_det;
+      double n2 = (adj[4]*g0 + adj[5]*g1 + adj[2]*g2) * inv_det;
+      double w0 = singular ? -g0 : -n0;
+      double w1 = singular ? -g1 : -n1;
+      double w2 = singular ? -g2 : -n2;
+      w[0][l] = active ? w0 : 0.0;
+      w[1][l] = active ? w1 : 0.0;
+      w[2][l] = active ? w2 : 0.0;
+      E0[l] = -tr;
+      search[l] = active;
+      nactive += active;
+    }
+
+    if (nactive == 0) {
+      break;
+    }
+
+    // Backtracking until the energy decreases or the step vanishes.
+    // Converged lanes keep an identity update.
+    for (int k = 0; k < 9; ++k) {
+      #pragma omp simd
+      for (int l = 0; l < W; ++l) {
+        dR.v[k][l] = (k % 4 == 0) ? 1.0 : 0.0;
+      }
+    }
+
+    int nsearch = nactive;
+    while (nsearch > 0) {
+      nsearch = 0;
+      #pragma omp simd reduction(+ : nsearch)
+      for (int l = 0; l < W; ++l) {
+        double Rw[9];
+        rodrigues(w[0][l], w[1][l], w[2][l], Rw);
+
+        // E1 = -tr(dR * Y)
+        double E1 = 0;
+        for (int i = 0; i < 3; ++i) {
+          for (int j = 0; j < 3; ++j) {
+            E1 -= Rw[3*j + i] * Y(j,i)[l];
+          }
+        }
+
+        bool on = search[l];
+        for (int k = 0; k < 9; ++k) {
+          dR.v[k][l] = on ? Rw[k] : dR.v[k][l];
+        }
+        double scale = on ? 0.6 : 1.0;
+        w[0][l] *= scale;
+        w[1][l] *= scale;
+        w[2][l] *= scale;
+        double wn2 = w[0][l]*w[0][l] + w[1][l]*w[1][l] + w[2][l]*w[2][l];
+        search[l] = on && E1 > E0[l] && wn2 > tol*tol;
+        nsearch += search[l];
+      }
+    }
+
+    lane_multiply(dR, R, tmp);
+    R = tmp;
+    lane_multiply(dR, Y, tmp);
+    Y = tmp;
+  }
+
+  // S = R^T F
+  LaneMatrix<double,3,3> S;
+  lane_transpose_multiply(R, F, S);
+  #pragma omp simd
+  for (int l = 0; l < W; ++l) {
+    s(0,0)[l] = S(0,0)[l];
+    s(1,0)[l] = S(1,1)[l];
+    s(2,0)[l] = S(2,2)[l];
+    s(3,0)[l] = 0.5*(S(1,0)[l] + S(0,1)[l]);
+    s(4,0)[l] = 0.5*(S(2,0)[l] + S(0,2)[l]);
+    s(5,0)[l] = 0.5*(S(2,1)[l] + S(1,2)[l]);
+  }
+
+  if (dsdF == nullptr) {
+    return;
+  }
+
+  // Perturbing F by E_rc rotates R by [dw]x R, where dw = H^-1 (R_c x e_r)
+  // and R_c is the c-th column of R. The stretch then changes by
+  //   dS = R^T (E_rc - [dw]x F)
+  LaneMatrix<double,6,9>& J = *dsdF;
+  #pragma omp simd
+  for (int l = 0; l < W; ++l) {
+    double tr = Y(0,0)[l] + Y(1,1)[l] + Y(2,2)[l];
+    double adj[6];
+    double det = adjugate(tr - Y(0,0)[l], tr - Y(1,1)[l], tr - Y(2,2)[l],
+        -0.5*(Y(0,1)[l] + Y(1,0)[l]),
+        -0.5*(Y(0,2)[l] + Y(2,0)[l]),
+        -0.5*(Y(1,2)[l] + Y(2,1)[l]), adj);
+    double inv_det = det != 0 ? 1.0 / det : 0.0;
+
+    double Rl[9], Fl[9];
+    for (int k = 0; k < 9; ++k) {
+      Rl[k] = R.v[k][l];
+      Fl[k] = F.v[k][l];
+    }
+
+    for (int c = 0; c < 3; ++c) {
+      for (int r = 0; r < 3; ++r) {
+        // q = R_c x e_r
+        double q[3] = {0, 0, 0};
+        q[(r+1)%3] = Rl[3*c + (r+2)%3];
+        q[(r+2)%3] = -Rl[3*c + (r+1)%3];
+
+        double dw0 = (adj[0]*q[0] + adj[3]*q[1] + adj[4]*q[2]) * inv_det;
+        double dw1 = (adj[3]*q[0] + adj[1]*q[1] + adj[5]*q[2]) * inv_det;
+        double dw2 = (adj[4]*q[0] + adj[5]*q[1] + adj[2]*q[2]) * inv_det;
+
+        // U = E_rc - dw x F
+        double U[9];
+        for (int j = 0; j < 3; ++j) {
+          const double* f = Fl + 3*j;
+          U[3*j + 0] = -(dw1*f[2] - dw2*f[1]);
+          U[3*j + 1] = -(dw2*f[0] - dw0*f[2]);
+          U[3*j + 2] = -(dw0*f[1] - dw1*f[0]);
+        }
+        U[3*c + r] += 1.0;
+
+        // dS = R^T U
+        double dS[9];
+        for (int j = 0; j < 3; ++j) {
+          for (int i = 0; i < 3; ++i) {
+            dS[3*j + i] = Rl[3*i]*U[3*j] + Rl[3*i + 1]*U[3*j + 1]
+                + Rl[3*i + 2]*U[3*j + 2];
+          }
+        }
+
+        int col = 3*c + r;
+        J(0,col)[l] = dS[0];
+        J(1,col)[l] = dS[4];
+        J(2,col)[l] = dS[8];
+        J(3,col)[l] = 0.5*(dS[1] + dS[3]);
+        J(4,col)[l] = 0.5*(dS[2] + dS[6]);
+        J(5,col)[l] = 0.5*(dS[5] + dS[7]);
+      }
+    }
+  }
+}
+
+void mfem::batch_polar(const LaneMatrix<double,2,2>& F,
+    LaneMatrix<double,2,2>& R, LaneMatrix<double,3,1>& s,
+    LaneMatrix<double,3,4>* dsdF) {
+
+  // The closest rotation has angle t = atan2(F10 - F01, F00 + F11)
+  #pragma omp simd
+  for (int l = 0; l < W; ++l) {
+    double F00 = F(0,0)[l], F10 = F(1,0)[l];
+    double F01 = F(0,1)[l], F11 = F(1,1)[l];
+    double a = F00 + F11;
+    double b = F10 - F01;
+    double r2 = a*a + b*b;
+    double inv_r = r2 > 0 ? 1.0 / std::sqrt(r2) : 0.0;
+    double c = r2 > 0 ? a * inv_r : 1.0;
+    double sn = b * inv_r;
+
+    R(0,0)[l] = c;
+    R(1,0)[l] = sn;
+    R(0,1)[l] = -sn;
+    R(1,1)[l] = c;
+
+    // S = R^T F
+    double S00 = c*F00 + sn*F10;
+    double S10 = -sn*F00 + c*F10;
+    double S01 = c*F01 + sn*F11;
+    double S11 = -sn*F01 + c*F11;
+    s(0,0)[l] = S00;
+    s(1,0)[l] = S11;
+    s(2,0)[l] = 0.5*(S10 + S01);
+
+    if (dsdF != nullptr) {
+      // dS = (dR/dt)^T F dt + R^T E_rc, where (dR/dt)^T F = [S10 S11;
+      // -S00 -S01] and dt/dF = [-b a -a -b] / (a^2 + b^2)
+      double inv_r2 = r2 > 0 ? 1.0 / r2 : 0.0;
+      double dt[4] = {-b*inv_r2, a*inv_r2, -a*inv_r2, -b*inv_r2};
+      double Rl[4] = {c, sn, -sn, c};
+      LaneMatrix<double,3,4>& J = *dsdF;
+      for (int col = 0; col < 4; ++col) {
+        int r = col % 2;
+        int cc = col / 2;
+        // R^T E_rc has row r of R in column cc
+        double E00 = (cc == 0) ? Rl[r] : 0.0;
+        double E10 = (cc == 0) ? Rl[2 + r] : 0.0;
+        double E01 = (cc == 1) ? Rl[r] : 0.0;
+        double E11 = (cc == 1) ? Rl[2 + r] : 0.0;
+        J(0,col)[l] = S10*dt[col] + E00;
+        J(1,col)[l] = -S01*dt[col] + E11;
+        J(2,col)[l] = 0.5*((-S00 + S11)*dt[col] + E10 + E01);
+      }
+    }
+  }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "batch_matrix.h"
+
+namespace mfem {
+
+  // Polar decompositions F = R*S for all elements in a lane group. The
+  // per-lane work is written as straight-line code over the lanes so it
+  // vectorizes across elements for whatever SIMD width BATCH_WIDTH was
+  // chosen for (SSE/AVX2 with 4 doubles, AVX-512 with 8).
+  //
+  // The stretch is returned in the vector form used by the mixed
+  // variables. For 3D:
+  //   s = [S00 S11 S22 (S10+S01)/2 (S20+S02)/2 (S21+S12)/2]
+  // and for 2D:
+  //   s = [S00 S11 (S10+S01)/2]
+  // and ds/dF is with respect to the column-major vectorized F.
+
+  // 3D rotations are found with the Newton procrustes iteration. Lanes
+  // that have converged are masked out while the rest keep iterating.
+  // F        - deformation gradients
+  // R        - rotations. On input, the initial guess for each lane
+  // s        - vectorized symmetric stretches
+  // dsdF     - if not null, the stretch jacobians ds/dF
+  // tol      - convergence tolerance on the rotation gradient norm
+  // max_iter - maximum number of Newton iterations
+  void batch_polar(const LaneMatrix<double,3,3>& F, LaneMatrix<double,3,3>& R,
+      LaneMatrix<double,6,1>& s, LaneMatrix<double,6,9>* dsdF = nullptr,
+      double tol = 1e-6, int max_iter = 100);
+
+  // 2D rotations are computed in closed form, so no initial guess is used.
+  void batch_polar(const LaneMatrix<double,2,2>& F, LaneMatrix<double,2,2>& R,
+      LaneMatrix<double,3,1>& s, LaneMatrix<double,3,4>* dsdF = nullptr);
+
+}
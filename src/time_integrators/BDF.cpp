@@ -1,11 +1,20 @@
 #include "BDF.h"
 
+#include <algorithm>
+
 using namespace mfem;
 using namespace Eigen;
 
 template <int I>
-Eigen::VectorXd BDF<I>::x_tilde() const {
-	return weighted_sum(x_prevs_) + dt() * weighted_sum(v_prevs_);
+const Eigen::VectorXd& BDF<I>::x_tilde() const {
+	return x_tilde_;
+}
+
+template <int I>
+void BDF<I>::update_x_tilde() {
+	weighted_sum(x_prevs_, x_tilde_);
+	weighted_sum(v_prevs_, wx_);
+	x_tilde_ += dt() * wx_;
 }
 
 template <int I>
@@ -15,29 +24,96 @@ double BDF<I>::dt() const {
 
 template <int I>
 void BDF<I>::update(const VectorXd& x) {
-	VectorXd wx = weighted_sum(x_prevs_);
-
-	x_prevs_.push_front(x);
-	v_prevs_.push_front((x - wx) / dt());
+	weighted_sum(x_prevs_, wx_);
 
+	// Once the history is full, the oldest sample's storage is reused for
+	// the newest so steady state steps don't allocate
 	if (x_prevs_.size() > I) {
-		x_prevs_.pop_back();
-		v_prevs_.pop_back();
+		std::rotate(x_prevs_.begin(), x_prevs_.end() - 1, x_prevs_.end());
+		x_prevs_.front() = x;
+	} else {
+		x_prevs_.push_front(x);
+	}
+	if (v_prevs_.size() >= I) {
+		std::rotate(v_prevs_.begin(), v_prevs_.end() - 1, v_prevs_.end());
+		v_prevs_.front() = (x - wx_) / dt();
+	} else {
+		v_prevs_.push_front((x - wx_) / dt());
+	}
+	update_x_tilde();
+}
+
+template <int I>
+void BDF<I>::set_timestep(double h) {
+	if (h == h_) {
+		return;
+	}
+	resample(x_prevs_, h / h_);
+	resample(v_prevs_, h / h_);
+	h_ = h;
+	update_x_tilde();
+}
+
+template <int I>
+bool BDF<I>::load_state(const Checkpoint& ckpt) {
+	if (!ImplicitIntegrator::load_state(ckpt)) {
+		return false;
+	}
+	update_x_tilde();
+	return true;
+}
+
+template <int I>
+void BDF<I>::resample(std::deque<VectorXd>& x, double ratio) {
+	int n = x.size();
+	std::deque<VectorXd> y(n, VectorXd::Zero(x.front().size()));
+
+	// The new samples lie at m * ratio in units of the old spacing. Weight
+	// the old samples by the Lagrange basis over nodes 0, ..., n-1.
+	for (int m = 0; m < n; ++m) {
+		double s = m * ratio;
+		for (int j = 0; j < n; ++j) {
+			double w = 1.0;
+			for (int k = 0; k < n; ++k) {
+				if (k != j) {
+					w *= (s - k) / (j - k);
+				}
+			}
+			y[m] += w * x[j];
+		}
+	}
+	x = std::move(y);
+}
+
+template <int I>
+double BDF<I>::error_estimate(const VectorXd& x) const {
+	// Milne's estimate. Extrapolating the I+1 previous positions gives a
+	// predictor of order I with error constant C* = 1; the weights are
+	// (-1)^j (I+1 choose j+1). BDF-I has error constant C = -beta/(I+1), so
+	// the local error is |C| / (C* - C) times the predictor-corrector
+	// difference, e.g. 1/3 for BDF1 and 2/11 for BDF2.
+	VectorXd x_pred = VectorXd::Zero(x.size());
+	double c = I + 1;
+	for (int j = 0; j <= I; ++j) {
+		x_pred += c * x_prevs_[j];
+		c *= -double(I - j) / (j + 2);
 	}
+	const double C = beta() / (I + 1);
+	return (x - x_pred).lpNorm<Infinity>() * C / (1.0 + C);
 }
 
 template <int I>
-VectorXd BDF<I>::weighted_sum(const std::deque<VectorXd>& x) const {
+void BDF<I>::weighted_sum(const std::deque<VectorXd>& x, VectorXd& wx)
+		const {
 	const std::array<double,I>& a = alphas();
 
-	assert(x.size() > 0 && x.size() <= I);
+	assert(x.size() >= I);
 
-	VectorXd wx = VectorXd::Zero(x.front().size());
+	wx.setZero(x.front().size());
 
-	for (int i = 0; i < x.size(); ++i) {
+	for (int i = 0; i < I; ++i) {
 		wx += a[i] * x[i];
 	}
-	return wx;
 }
 
 
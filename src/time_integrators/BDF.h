@@ -23,17 +23,37 @@ namespace mfem {
 				x_prevs_.push_front(x0);
 				v_prevs_.push_front(v0);
 			}
+			// One more position for the error estimate
+			x_prevs_.push_back(x0);
+			update_x_tilde();
 		}
 
-    Eigen::VectorXd x_tilde() const override;
+    const Eigen::VectorXd& x_tilde() const override;
     double dt() const override;
     void update(const Eigen::VectorXd& x) override;
 
+		int order() const override {
+			return I;
+		}
+
+    void set_timestep(double h) override;
+    double error_estimate(const Eigen::VectorXd& x) const override;
+    bool load_state(const Checkpoint& ckpt) override;
+
 	private:
 
-		Eigen::VectorXd weighted_sum(const std::deque<Eigen::VectorXd>& x) const;
+		// Replaces the values in x, sampled every h_ going back from the
+		// current time, by their polynomial interpolant sampled every h
+		static void resample(std::deque<Eigen::VectorXd>& x, double ratio);
+
+		void update_x_tilde();
+		void weighted_sum(const std::deque<Eigen::VectorXd>& x,
+				Eigen::VectorXd& wx) const;
 		constexpr std::array<double,I> alphas() const;
 		constexpr double beta() const;
+
+		Eigen::VectorXd x_tilde_;
+		Eigen::VectorXd wx_; // tmp var: weighted sum of a history
   };
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EigenTypes.h"
+#include "checkpoint.h"
 #include <deque>
 
 namespace mfem {
@@ -12,15 +13,101 @@ namespace mfem {
         : h_(h) {}
         
     virtual ~ImplicitIntegrator() = default;
-    virtual Eigen::VectorXd x_tilde() const = 0;
+
+    // Inertial target of the current timestep. Cached between updates so
+    // the Newton iterations within a step don't rebuild it.
+    virtual const Eigen::VectorXd& x_tilde() const = 0;
+
     virtual double dt() const = 0;
+
+    // Timestep size
+    double h() const {
+      return h_;
+    }
+
+    // Order of accuracy of the integrator
+    virtual int order() const = 0;
+
+    // Changes the size of the following timesteps. Multistep integrators
+    // resample their history at the new spacing.
+    virtual void set_timestep(double h) = 0;
+
+    // Estimate of the local truncation error (max norm) of the positions x
+    // solved for at the end of the current timestep
+    virtual double error_estimate(const Eigen::VectorXd& x) const = 0;
+
+    // Extrapolates the positions at the end of the current timestep from
+    // the position and velocity history. Used as the initial guess of the
+    // timestep's solve. By default this is the inertial target, the
+    // integrator's constant velocity extrapolation. External forces are
+    // left out since in most scenes they are largely balanced by the
+    // elastic forces.
+    virtual void predict(Eigen::VectorXd& x) const {
+      x = x_tilde();
+    }
+
     virtual void update(const Eigen::VectorXd& x) = 0;
     virtual void reset() {
       x_prevs_.clear();
       v_prevs_.clear();
     }
+
+    // Saves the timestep size and the position and velocity history
+    void save_state(Checkpoint& ckpt) const {
+      ckpt.set("integrator/h", Eigen::Matrix<double,1,1>(h_));
+      ckpt.set("integrator/x_prevs", to_columns(x_prevs_));
+      ckpt.set("integrator/v_prevs", to_columns(v_prevs_));
+    }
+
+    // Whether the checkpoint's history matches this integrator's
+    bool check_state(const Checkpoint& ckpt) const {
+      Eigen::MatrixXd h, X, V;
+      return ckpt.get("integrator/h", h) && h.size() == 1
+          && ckpt.get("integrator/x_prevs", X)
+          && ckpt.get("integrator/v_prevs", V)
+          && same_shape(X, x_prevs_) && same_shape(V, v_prevs_);
+    }
+
+    // Restores the state saved by save_state(). Returns false if the
+    // checkpoint's history doesn't match this integrator's.
+    virtual bool load_state(const Checkpoint& ckpt) {
+      if (!check_state(ckpt)) {
+        return false;
+      }
+      Eigen::MatrixXd h, X, V;
+      ckpt.get("integrator/h", h);
+      ckpt.get("integrator/x_prevs", X);
+      ckpt.get("integrator/v_prevs", V);
+      h_ = h(0);
+      from_columns(X, x_prevs_);
+      from_columns(V, v_prevs_);
+      return true;
+    }
+
   protected:
 
+    // History stored as the columns of a matrix
+    static Eigen::MatrixXd to_columns(const std::deque<Eigen::VectorXd>& x) {
+      Eigen::MatrixXd X(x.front().size(), x.size());
+      for (size_t i = 0; i < x.size(); ++i) {
+        X.col(i) = x[i];
+      }
+      return X;
+    }
+
+    static bool same_shape(const Eigen::MatrixXd& X,
+        const std::deque<Eigen::VectorXd>& x) {
+      return X.cols() == Eigen::Index(x.size())
+          && X.rows() == x.front().size();
+    }
+
+    static void from_columns(const Eigen::MatrixXd& X,
+        std::deque<Eigen::VectorXd>& x) {
+      for (size_t i = 0; i < x.size(); ++i) {
+        x[i] = X.col(i);
+      }
+    }
+
     double h_;
     std::deque<Eigen::VectorXd> x_prevs_;
     std::deque<Eigen::VectorXd> v_prevs_;
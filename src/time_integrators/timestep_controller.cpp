@@ -0,0 +1,51 @@
+#include "timestep_controller.h"
+#include "config.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace mfem;
+using namespace Eigen;
+
+namespace {
+  constexpr double safety = 0.9;      // target fraction of lte_tol
+  constexpr double max_growth = 2.0;  // limit on step growth
+  constexpr double min_shrink = 0.2;  // limit on step reduction
+  constexpr double min_change = 1.2;  // smaller growth keeps the step
+}
+
+double TimestepController::factor(double error, int order) const {
+  if (error <= 0) {
+    return max_growth;
+  }
+  double f = safety * std::pow(1.0 / error, 1.0 / (order + 1));
+  return std::clamp(f, min_shrink, max_growth);
+}
+
+double TimestepController::step(ImplicitIntegrator& integrator,
+    const std::function<bool(VectorXd&)>& solve,
+    const std::function<void()>& restore) {
+  rejections_ = 0;
+
+  while (true) {
+    double h = integrator.h();
+    bool converged = solve(x_);
+    error_ = integrator.error_estimate(x_) / config_->lte_tol;
+
+    if ((converged && error_ <= 1.0) || h <= config_->h_min) {
+      double f = factor(error_, integrator.order());
+      if (f >= 1.0 && f < min_change) {
+        f = 1.0;
+      }
+      h_next_ = std::clamp(h * f, config_->h_min, config_->h_max);
+      return h;
+    }
+
+    // Halve steps that failed to converge, otherwise shrink to the error
+    // estimate
+    double f = converged ? std::min(factor(error_, integrator.order()),
+        safety) : 0.5;
+    integrator.set_timestep(std::max(h * f, config_->h_min));
+    restore();
+    ++rejections_;
+  }
+}
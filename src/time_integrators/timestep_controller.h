@@ -0,0 +1,61 @@
+#pragma once
+
+#include "implicit_integrator.h"
+#include <functional>
+#include <memory>
+
+namespace mfem {
+
+  class SimConfig;
+
+  // Adaptive timestep control for the implicit integrators. A timestep is
+  // rejected and retried with a smaller step when Newton fails to converge
+  // or the integrator's local truncation error estimate is above
+  // SimConfig::lte_tol. Accepted steps choose the next step size from the
+  // error estimate, so quiet phases grow the step up to SimConfig::h_max.
+  class TimestepController {
+  public:
+
+    TimestepController(std::shared_ptr<SimConfig> config)
+        : config_(config) {}
+
+    // Takes one timestep, retrying until it is accepted.
+    // integrator - integrator of the variables being solved for
+    // solve      - runs the Newton iterations of the current timestep and
+    //              returns whether they converged. Writes the resulting
+    //              unprojected positions to its argument.
+    // restore    - resets the variables to the start of the timestep
+    // Returns the size of the accepted step.
+    double step(ImplicitIntegrator& integrator,
+        const std::function<bool(Eigen::VectorXd&)>& solve,
+        const std::function<void()>& restore);
+
+    // Step size to switch to once the accepted step is applied to the
+    // integrator
+    double next() const {
+      return h_next_;
+    }
+
+    // Error estimate of the last accepted step relative to lte_tol
+    double error() const {
+      return error_;
+    }
+
+    // Number of rejected steps during the last call to step()
+    int rejections() const {
+      return rejections_;
+    }
+
+  private:
+
+    // Step size factor for an error estimate relative to lte_tol
+    double factor(double error, int order) const;
+
+    std::shared_ptr<SimConfig> config_;
+    Eigen::VectorXd x_;
+    double h_next_ = 0;
+    double error_ = 0;
+    int rejections_ = 0;
+  };
+
+}
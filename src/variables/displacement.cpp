@@ -21,19 +21,28 @@ template<int DIM>
 double Displacement<DIM>::energy(const VectorXd& x) {
 
   double h = integrator_->dt();
-  VectorXd xt = P_.transpose()*x + b_;
-  VectorXd diff = xt - integrator_->x_tilde() - h*h*f_ext_;
-  double e = 0.5*diff.transpose()*M_*diff;
+  unproject(x, xt_);
+  diff_ = xt_ - integrator_->x_tilde() - h*h*f_ext_;
+  Mdiff_.noalias() = M_ * diff_;
+  double e = 0.5*diff_.dot(Mdiff_);
 
   if (!is_mixed_) {
-    VectorXd def_grad;
-    mesh_->deformation_gradient(xt, def_grad);
+    const VectorXd& vols = mesh_->volumes();
+    int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
     double e_psi = 0.0;
+
     #pragma omp parallel for reduction(+ : e_psi)
-    for (int i = 0; i < nelem_; ++i) {
-      double vol = mesh_->volumes()[i];
-      const VecM& F = def_grad.segment<M()>(M()*i);
-      e_psi += mesh_->material_->energy(F) * vol;
+    for (int b = 0; b < nbatch; ++b) {
+      LaneMatrix<double,M(),1> F;
+      gather_deformation_gradients(b, xt_, F);
+
+      double psi[BATCH_WIDTH];
+      mesh_->material_->energy(F, psi);
+
+      int lanes = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+      for (int l = 0; l < lanes; ++l) {
+        e_psi += psi[l] * vols[BATCH_WIDTH*b + l];
+      }
     }
     e += e_psi * h * h;
   }
@@ -43,7 +52,7 @@ double Displacement<DIM>::energy(const VectorXd& x) {
 template<int DIM>
 void Displacement<DIM>::post_solve() {
   // Update boundary positions
-  BCs_.step_script(mesh_, config_->h);
+  BCs_.step_script(mesh_, integrator_->h());
 
   #pragma omp parallel for
   for (int i = 0; i < mesh_->V_.rows(); ++i) {
@@ -52,12 +61,62 @@ void Displacement<DIM>::post_solve() {
     }
   }
 
-  VectorXd x = P_.transpose()*x_ + b_;
-  integrator_->update(x);
+  x_full_.noalias() = P_.transpose()*x_;
+  x_full_ += b_;
+  integrator_->update(x_full_);
 
   // Update mesh vertices
-  MatrixXd V = Map<MatrixXd>(x.data(), mesh_->V_.cols(), mesh_->V_.rows());
-  mesh_->V_ = V.transpose();
+  mesh_->V_ = Map<const MatrixXd>(x_full_.data(), mesh_->V_.cols(),
+      mesh_->V_.rows()).transpose();
+}
+
+template<int DIM>
+void Displacement<DIM>::save_state(Checkpoint& ckpt) const {
+  ckpt.set("x", x_);
+  ckpt.set("b", b_);
+  ckpt.set("mesh/V", mesh_->V_);
+  ckpt.set("mesh/fixed", mesh_->is_fixed_.template cast<double>());
+  BCs_.save_state(ckpt);
+  integrator_->save_state(ckpt);
+}
+
+template<int DIM>
+bool Displacement<DIM>::load_state(const Checkpoint& ckpt) {
+  VectorXd x, b, fixed;
+  MatrixXd V;
+  if (!ckpt.get("x", x) || x.size() != x_.size()
+      || !ckpt.get("b", b) || b.size() != b_.size()
+      || !ckpt.get("mesh/V", V) || V.rows() != mesh_->V_.rows()
+      || V.cols() != mesh_->V_.cols()
+      || !ckpt.get("mesh/fixed", fixed)
+      || fixed.size() != mesh_->is_fixed_.size()
+      || !BCs_.check_state(ckpt) || !integrator_->check_state(ckpt)) {
+    return false;
+  }
+
+  // Everything is validated, so the state is restored in full
+  BCs_.load_state(ckpt);
+  integrator_->load_state(ckpt);
+  x_ = x;
+  b_ = b;
+  mesh_->V_ = V;
+
+  // Scripts may free vertices while stepping
+  mesh_->is_fixed_ = fixed.cast<int>();
+  mesh_->fixed_vertices_.clear();
+  for (int i = 0; i < mesh_->is_fixed_.size(); ++i) {
+    if (mesh_->is_fixed_(i)) {
+      mesh_->fixed_vertices_.push_back(i);
+    }
+  }
+  return true;
+}
+
+template<int DIM>
+void Displacement<DIM>::predict(VectorXd& x) {
+  integrator_->predict(x);
+  x_.noalias() = P_ * x;
+  unproject(x_, x);
 }
 
 template<int DIM>
@@ -67,28 +126,86 @@ void Displacement<DIM>::update(const Eigen::VectorXd&, double) {
     double h = integrator_->dt();
     double h2 = h*h;
 
-    VectorXd def_grad;
-    mesh_->deformation_gradient(P_.transpose()*x_+b_, def_grad);
+    unproject(x_, xt_);
+
+    if (assembler_f_) {
+      update_derivatives(xt_, h2, H_f_);
+      assembler_f_->update_matrix(H_f_);
+      if (config_->system_precision == SYSTEM_SINGLE) {
+        lhs_f_ = PMP_f_ + assembler_f_->A;
+      } else {
+        lhs_ = PMP_ + assembler_f_->A.template cast<double>();
+      }
+    } else if (bsr_assembler_) {
+      update_derivatives(xt_, h2, H_);
+      bsr_assembler_->update_matrix(H_);
+      lhs_bsr_ = bsr_assembler_->A;
+      lhs_bsr_ += PMP_bsr_;
+    } else {
+      update_derivatives(xt_, h2, H_);
+      assembler_->update_matrix(H_);
+      lhs_ = PMP_ + assembler_->A;
+    }
+  }
+}
+
+template<int DIM>
+template<typename Scalar>
+void Displacement<DIM>::update_derivatives(const VectorXd& x, double h2,
+    ElementBlocks<Scalar>& H) {
+  const ElementBlocks<double>& Jloc = mesh_->local_jacobians();
+  const VectorXd& vols = mesh_->volumes();
+  const Mesh& mesh = *mesh_;
+
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
 
-    const std::vector<MatrixXd>& Jloc = mesh_->local_jacobians();
+  dispatch_element_size<DIM>(mesh.T_.cols(), [&](auto size) {
+    constexpr int K = decltype(size)::value;
 
-    // Computing per-element hessian and gradients
     #pragma omp parallel for
-    for (int i = 0; i < nelem_; ++i) {
-      const VecM& F = def_grad.segment<M()>(M()*i);
-      double vol = mesh_->volumes()[i];
-      
-      H_[i] = (Jloc[i].transpose() * mesh_->material_->hessian(F)
-          * Jloc[i]) * vol * h2;
-      g_[i] = Jloc[i].transpose() * mesh_->material_->gradient(F) * vol * h2;
+    for (int b = 0; b < nbatch; ++b) {
+      // Material derivatives for the whole lane group at once
+      LaneMatrix<double,M(),1> F, dPsidF;
+      LaneMatrix<double,M(),M()> d2PsidF2;
+      this->gather_deformation_gradients(b, x, F);
+      mesh.material_->gradient(F, dPsidF);
+      mesh.material_->hessian(F, d2PsidF2);
+
+      int lanes = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+      for (int l = 0; l < lanes; ++l) {
+        int i = BATCH_WIDTH*b + l;
+        double vol = vols[i];
+        Map<const Matrix<double,M(),K>> J = Jloc.block<M(),K>(i);
+
+        // Gradients are always computed in double
+        g_.template block<K,1>(i).noalias() = J.transpose()
+            * dPsidF.get(l) * (vol * h2);
+
+        Matrix<Scalar,M(),K> Js = J.template cast<Scalar>();
+        Matrix<Scalar,M(),M()> Hl = d2PsidF2.get(l).template cast<Scalar>();
+        H.template block<K,K>(i).noalias() = (Js.transpose() * Hl * Js)
+            * (Scalar(vol) * Scalar(h2));
+      }
+    }
+  });
+}
+
+template<int DIM>
+void Displacement<DIM>::gather_deformation_gradients(int b,
+    const VectorXd& x, LaneMatrix<double,DIM*DIM,1>& F) {
+  const MatD I = MatD::Identity();
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    int i = BATCH_WIDTH*b + l;
+    if (i < nelem_) {
+      F.set(l, mesh_->template element_deformation_gradient<DIM>(i, x));
+    } else {
+      F.set(l, Map<const VecM>(I.data()));
     }
-    assembler_->update_matrix(H_);
-    lhs_ = PMP_ + assembler_->A;
   }
 }
 
 template<int DIM>
-VectorXd Displacement<DIM>::rhs() {
+const VectorXd& Displacement<DIM>::rhs() {
   data_.timer.start("RHS - x");
   rhs_ = -gradient();
   data_.timer.stop("RHS - x");
@@ -96,39 +213,155 @@ VectorXd Displacement<DIM>::rhs() {
 }
 
 template<int DIM>
-VectorXd Displacement<DIM>::gradient() {
+const VectorXd& Displacement<DIM>::gradient() {
   double h = integrator_->dt();
-  double h2 = h*h;
-  VectorXd xt = P_.transpose()*x_ + b_;
-  VectorXd diff = xt - integrator_->x_tilde() - h*h*f_ext_;
-  grad_ = PM_ * diff;
+  unproject(x_, xt_);
+  diff_ = xt_ - integrator_->x_tilde() - h*h*f_ext_;
+  grad_.noalias() = PM_ * diff_;
 
   if (!is_mixed_) {
     // Assuming update() was called to update per-element gradients, g_
-    VectorXd g;
-    vec_assembler_->assemble(g_, g);
-    grad_ += g;
+    vec_assembler_->assemble(g_, gpsi_);
+    grad_ += gpsi_;
   }
 
   return grad_;
 }
 
+template<int DIM>
+void Displacement<DIM>::linesearch_begin(const VectorXd& x,
+    const VectorXd& dx) {
+  double h = integrator_->dt();
+  diff_ = x - integrator_->x_tilde() - h*h*f_ext_;
+  Mdiff_.noalias() = M_ * diff_;
+  inertia_[0] = 0.5 * diff_.dot(Mdiff_);
+  inertia_[1] = dx.dot(Mdiff_);
+  Mdiff_.noalias() = M_ * dx;
+  inertia_[2] = 0.5 * dx.dot(Mdiff_);
+
+  if (is_mixed_) {
+    return;
+  }
+
+  linear_F_ = mesh_->T_.cols() == DIM + 1;
+  if (!linear_F_) {
+    ls_x_ = x;
+    ls_dx_ = dx;
+    return;
+  }
+
+  F0_.resize(nelem_);
+  dF_.resize(nelem_);
+
+  #pragma omp parallel for
+  for (int b = 0; b < F0_.batches(); ++b) {
+    gather_deformation_gradients(b, x, F0_.batch(b));
+    gather_deformation_gradients(b, dx, dF_.batch(b));
+    for (int l = F0_.lanes(b); l < BATCH_WIDTH; ++l) {
+      dF_.batch(b).set(l, VecM::Zero());
+    }
+  }
+}
+
+template<int DIM>
+void Displacement<DIM>::linesearch_values(const double* alpha, int n,
+    double* f) {
+  assert(n <= MAX_LINESEARCH_CANDIDATES);
+  for (int j = 0; j < n; ++j) {
+    f[j] = inertia_[0] + alpha[j] * (inertia_[1] + alpha[j] * inertia_[2]);
+  }
+
+  if (is_mixed_) {
+    return;
+  }
+
+  double h = integrator_->dt();
+  const VectorXd& vols = mesh_->volumes();
+  int nbatch = (nelem_ + BATCH_WIDTH - 1) / BATCH_WIDTH;
+
+  // Volume weighted elastic energy of group b
+  auto group_energy = [&](int b, const LaneMatrix<double,M(),1>& F) {
+    double psi[BATCH_WIDTH];
+    mesh_->material_->energy(F, psi);
+
+    double e = 0.0;
+    int lanes = std::min(BATCH_WIDTH, nelem_ - BATCH_WIDTH*b);
+    for (int l = 0; l < lanes; ++l) {
+      e += psi[l] * vols[BATCH_WIDTH*b + l];
+    }
+    return e;
+  };
+
+  if (linear_F_) {
+    double e_psi[MAX_LINESEARCH_CANDIDATES] = {};
+
+    #pragma omp parallel for reduction(+ : e_psi)
+    for (int b = 0; b < nbatch; ++b) {
+      const LaneMatrix<double,M(),1>& F0 = F0_.batch(b);
+      const LaneMatrix<double,M(),1>& dF = dF_.batch(b);
+      for (int j = 0; j < n; ++j) {
+        LaneMatrix<double,M(),1> F;
+        for (int k = 0; k < M(); ++k) {
+          #pragma omp simd
+          for (int l = 0; l < BATCH_WIDTH; ++l) {
+            F.v[k][l] = F0.v[k][l] + alpha[j] * dF.v[k][l];
+          }
+        }
+        e_psi[j] += group_energy(b, F);
+      }
+    }
+
+    for (int j = 0; j < n; ++j) {
+      f[j] += e_psi[j] * h * h;
+    }
+  } else {
+    for (int j = 0; j < n; ++j) {
+      xt_ = ls_x_ + alpha[j] * ls_dx_;
+      double e_psi = 0.0;
+
+      #pragma omp parallel for reduction(+ : e_psi)
+      for (int b = 0; b < nbatch; ++b) {
+        LaneMatrix<double,M(),1> F;
+        gather_deformation_gradients(b, xt_, F);
+        e_psi += group_energy(b, F);
+      }
+      f[j] += e_psi * h * h;
+    }
+  }
+}
+
 template<int DIM>
 void Displacement<DIM>::reset() {
   nelem_ = mesh_->T_.rows();
 
-  H_.resize(nelem_);
-  g_.resize(nelem_);
-  Aloc_.resize(nelem_);
-  assembler_ = std::make_shared<Assembler<double,DIM,-1>>(
-      mesh_->T_, mesh_->free_map_);
+  int k = DIM*mesh_->T_.cols();
+  g_.resize(nelem_, k);
+
+  // Reduced precision modes form and assemble the element blocks in float.
+  // In single precision mode the assembled LHS stays in float as well.
+  assembler_ = nullptr;
+  assembler_f_ = nullptr;
+  bsr_assembler_ = nullptr;
+  if (config_->system_precision == SYSTEM_DOUBLE) {
+    H_.resize(nelem_, k, k);
+    if (config_->block_storage) {
+      bsr_assembler_ = std::make_shared<BSRAssembler<double,DIM,-1>>(
+          mesh_->T_, mesh_->free_map_);
+    } else {
+      assembler_ = std::make_shared<Assembler<double,DIM,-1>>(
+          mesh_->T_, mesh_->free_map_, config_->symmetric_storage);
+    }
+  } else {
+    H_f_.resize(nelem_, k, k);
+    assembler_f_ = std::make_shared<Assembler<float,DIM,-1>>(
+        mesh_->T_, mesh_->free_map_, config_->symmetric_storage);
+  }
   vec_assembler_ = std::make_shared<VecAssembler<double,DIM,-1>>(mesh_->T_,
-      mesh_->free_map_);
+      mesh_->free_map_, true);
 
   #pragma omp parallel for
   for (int i = 0; i < nelem_; ++i) {
-    H_[i].setIdentity();
-    g_[i].setZero();
+    g_.block(i).setZero();
   }
 
   mesh_->V_ = mesh_->V0_;
@@ -156,10 +389,22 @@ void Displacement<DIM>::reset() {
   // Project out mass matrix pinned point
   PMP_ = P_ * M_ * P_.transpose();
   PM_ = P_ * M_;
+  if (bsr_assembler_) {
+    PMP_bsr_ = bsr_assembler_->A;
+    PMP_bsr_.set_values(PMP_);
+    lhs_bsr_ = PMP_bsr_;
+  }
+  if (config_->symmetric_storage) {
+    PMP_ = PMP_.template triangularView<Upper>();
+  }
 
   // If mixed, lhs_ is not modified, otherwise in unmixed systems
   // the LHS is changed each step.
   lhs_ = PMP_;
+  if (config_->system_precision == SYSTEM_SINGLE) {
+    PMP_f_ = PMP_.template cast<float>();
+    lhs_f_ = PMP_f_;
+  }
 
   // External gravity force
   VecD ext = Map<Matrix<float,DIM,1>>(config_->ext).template cast<double>();
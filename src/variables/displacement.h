@@ -1,6 +1,7 @@
 #pragma once
 
 #include "variable.h"
+#include "batch_matrix.h"
 #include "optimizers/optimizer_data.h"
 #include "sparse_utils.h"
 #include "time_integrators/implicit_integrator.h"
@@ -26,13 +27,37 @@ namespace mfem {
     void reset() override;
     void post_solve() override;
 
-    Eigen::VectorXd rhs() override;
-    Eigen::VectorXd gradient() override;
+    // Saves the displacements, dirichlet values, vertex positions and the
+    // integrator and boundary condition state
+    void save_state(Checkpoint& ckpt) const;
+
+    // Restores the state saved by save_state(). Call after reset().
+    // Returns false if the checkpoint doesn't match this variable.
+    bool load_state(const Checkpoint& ckpt);
+
+    // Moves the displacements to the integrator's prediction for the
+    // current timestep. Returns the unprojected positions in x.
+    void predict(Eigen::VectorXd& x);
+
+    const Eigen::VectorXd& rhs() override;
+    const Eigen::VectorXd& gradient() override;
 
     const Eigen::SparseMatrix<double, Eigen::RowMajor>& lhs() override {
       return lhs_;
     }
 
+    // LHS in block storage. Only assembled if block_storage is enabled,
+    // in which case lhs() only holds the mass matrix.
+    const BSRMatrix<double,DIM>& lhs_bsr() const {
+      return lhs_bsr_;
+    }
+
+    // LHS in single precision. Only assembled if system_precision is
+    // SYSTEM_SINGLE, in which case lhs() only holds the mass matrix.
+    const Eigen::SparseMatrix<float, Eigen::RowMajor>& lhs_single() const {
+      return lhs_f_;
+    }
+
     Eigen::VectorXd& delta() override {
       return dx_;
     }
@@ -51,12 +76,58 @@ namespace mfem {
       x = P_.transpose() * x + b_;
     }
 
+    // Unprojects x into out without allocating once out is sized
+    void unproject(const Eigen::VectorXd& x, Eigen::VectorXd& out) const {
+      assert(x.size() == P_.rows());
+      out.noalias() = P_.transpose() * x;
+      out += b_;
+    }
+
+    // Unprojects a search direction, which leaves the dirichlet values
+    // unchanged
+    void unproject_delta(const Eigen::VectorXd& dx,
+        Eigen::VectorXd& out) const {
+      assert(dx.size() == P_.rows());
+      out.noalias() = P_.transpose() * dx;
+    }
+
+    // Caches the inertia term as a quadratic in the step length and, in
+    // unmixed systems, the per-element deformation gradients along the
+    // search direction.
+    // x  - unprojected displacements at the start of the search
+    // dx - unprojected search direction
+    void linesearch_begin(const Eigen::VectorXd& x,
+        const Eigen::VectorXd& dx);
+
+    // Energies at x + alpha[j] * dx, j < n, for the x and dx given to
+    // linesearch_begin(). n must not exceed MAX_LINESEARCH_CANDIDATES.
+    void linesearch_values(const double* alpha, int n, double* f);
+
+    double linesearch_value(double alpha) {
+      double f;
+      linesearch_values(&alpha, 1, &f);
+      return f;
+    }
+
     void set_mixed(bool is_mixed) {
       is_mixed_ = is_mixed;
     }
 
   private:
 
+    // Per-element gradients (in g_, double) and hessians (stored in the
+    // given precision), evaluated in double in a single pass over the
+    // elements.
+    // x - full vertex positions
+    template<typename Scalar>
+    void update_derivatives(const Eigen::VectorXd& x, double h2,
+        ElementBlocks<Scalar>& H);
+
+    // Flattened deformation gradients of the elements in lane group b
+    // (identity for padding)
+    void gather_deformation_gradients(int b, const Eigen::VectorXd& x,
+        LaneMatrix<double,DIM*DIM,1>& F);
+
     // Number of degrees of freedom per element
     // For DIM == 3 we have 6 DOFs per element, and
     // 3 DOFs for DIM == 2;
@@ -94,6 +165,10 @@ namespace mfem {
     Eigen::SparseMatrix<double, Eigen::RowMajor> PM_;  // projected mass matrix
     Eigen::SparseMatrix<double, Eigen::RowMajor> M_;   // mass matrix
     Eigen::SparseMatrix<double, Eigen::RowMajor> K_;   // stiffness matrix
+    BSRMatrix<double,DIM> lhs_bsr_;                      // block LHS
+    BSRMatrix<double,DIM> PMP_bsr_; // block projected mass matrix
+    Eigen::SparseMatrix<float, Eigen::RowMajor> lhs_f_;  // float LHS
+    Eigen::SparseMatrix<float, Eigen::RowMajor> PMP_f_; // float PMP_
 
     Eigen::VectorXd x_;       // displacement variables
     Eigen::VectorXd b_;       // dirichlet values
@@ -101,11 +176,29 @@ namespace mfem {
     Eigen::VectorXd rhs_;     // right-hand-side vector
     Eigen::VectorXd grad_;    // Gradient with respect to 's' variables
     Eigen::VectorXd f_ext_;   // body forces
-    std::vector<Eigen::VectorXd> g_;     // per-element gradients
-    std::vector<Eigen::MatrixXd> H_;     // per-element hessians
-    std::vector<Eigen::MatrixXd> Aloc_;
+    Eigen::VectorXd xt_;      // tmp var: unprojected displacements
+    Eigen::VectorXd diff_;    // tmp var: displacement from x_tilde
+    Eigen::VectorXd Mdiff_;   // tmp var: mass matrix times diff_
+    Eigen::VectorXd gpsi_;    // tmp var: assembled elastic gradient
+    Eigen::VectorXd x_full_;  // tmp var: unprojected positions in post_solve
+
+    // Line search state. The inertia term along the search direction is
+    // inertia_[0] + alpha*inertia_[1] + alpha^2*inertia_[2]. In unmixed
+    // systems, trial deformation gradients are F0_ + alpha * dF_ when they
+    // are linear in x, and are otherwise evaluated from ls_x_ + alpha*ls_dx_.
+    double inertia_[3];
+    BatchMatrix<double,DIM*DIM,1> F0_;
+    BatchMatrix<double,DIM*DIM,1> dF_;
+    bool linear_F_ = true;
+    Eigen::VectorXd ls_x_;
+    Eigen::VectorXd ls_dx_;
+    ElementBlocks<double> g_;            // per-element gradients
+    ElementBlocks<double> H_;            // per-element hessians
+    ElementBlocks<float> H_f_;           // single precision hessians
     Eigen::SparseMatrix<double, Eigen::RowMajor> A_;
     std::shared_ptr<Assembler<double,DIM,-1>> assembler_;
+    std::shared_ptr<Assembler<float,DIM,-1>> assembler_f_;
+    std::shared_ptr<BSRAssembler<double,DIM,-1>> bsr_assembler_;
     std::shared_ptr<VecAssembler<double,DIM,-1>> vec_assembler_;
   };
 }
@@ -27,7 +27,7 @@ namespace mfem {
     virtual void update(const Eigen::VectorXd& x, double dt) = 0;
 
     // Gradient of the energy with respect to mixed variable
-    virtual Eigen::VectorXd gradient_mixed() = 0;
+    virtual const Eigen::VectorXd& gradient_mixed() = 0;
 
     // Given the solution for displacements, solve the updates of the
     // mixed variables
@@ -37,6 +37,27 @@ namespace mfem {
     // Returns lagrange multipliers
     virtual Eigen::VectorXd& lambda() = 0;
 
+    // Caches the quantities the line search objective needs along the
+    // current search direction (delta() for the mixed variable)
+    // x  - unprojected nodal displacements at the start of the search
+    // dx - unprojected nodal displacement search direction
+    virtual void linesearch_begin(const Eigen::VectorXd& x,
+        const Eigen::VectorXd& dx) = 0;
+
+    // Line search objective at step lengths alpha[0..n-1], equal to
+    //   h2 * energy(s) - constraint_value(x + alpha*dx, s)
+    // for s = value() + alpha * delta(). Only element-local work is done,
+    // and all n step lengths are evaluated in a single pass.
+    // n must not exceed MAX_LINESEARCH_CANDIDATES.
+    virtual void linesearch_values(const double* alpha, int n, double h2,
+        double* f) = 0;
+
+    double linesearch_value(double alpha, double h2) {
+      double f;
+      linesearch_values(&alpha, 1, h2, &f);
+      return f;
+    }
+
   };
 
 }
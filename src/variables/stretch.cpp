@@ -1,93 +1,30 @@
 #include "stretch.h"
 #include "mesh/mesh.h"
 #include "energies/material_model.h"
-#include "svd/newton_procrustes.h"
-#include "svd/dsvd.h"
-#include "svd/svd_eigen.h"
+#include "svd/batch_polar.h"
+#include "config.h"
 
 using namespace Eigen;
 using namespace mfem;
 
 
-namespace {
-
-  template<int D, int N>
-  void polar_svd(Matrix<double,D,D>& R, Matrix<double,N,1>& s,
-      const Matrix<double,D,D>& A, bool compute_gradients,
-      Matrix<double, N, D*D>& dsdF) {
-    if constexpr (D == 3) {
-      Matrix9d dRdF;
-      // Compute R, and dR/dF
-      newton_procrustes(R, Matrix3d::Identity(), A, compute_gradients,
-          dRdF, 1e-6, 100);
-
-      // From rotations compute S & S in vec form
-      Matrix3d S = R.transpose() * A;
-      s << S(0,0), S(1,1), S(2,2),
-           0.5*(S(1,0) + S(0,1)),
-           0.5*(S(2,0) + S(0,2)),
-           0.5*(S(2,1) + S(1,2));
-
-      // dS/dF where S is 9x1 flattened 3x3 matrix
-      Matrix9d J = sim::flatten_multiply<Matrix3d>(R.transpose()) *
-        (Matrix9d::Identity() - sim::flatten_multiply_right<Matrix3d>(S)*dRdF);
-
-      // ds/dF where s is 6x1
-      dsdF.row(0) = J.row(0);
-      dsdF.row(1) = J.row(4);
-      dsdF.row(2) = J.row(8);
-      dsdF.row(3) = 0.5*(J.row(1) + J.row(3));
-      dsdF.row(4) = 0.5*(J.row(2) + J.row(6));
-      dsdF.row(5) = 0.5*(J.row(5) + J.row(7));
-
-    } else {
-      // Initial SVD computation
-      Matrix2d U,V;
-      Vector2d sval;
-      mfem::svd<double,2>(A, sval, U, V);
-
-      // Compute derivatives from SVD
-      Eigen::Tensor2222d dU, dV;
-      Eigen::Tensor222d dS;
-      dsvd(dU, dS, dV, A);
-      Matrix4d dRdF;
-      std::array<Matrix2d, 4> dR_dF;
-      for (int r = 0; r < 2; ++r) {
-        for (int c = 0; c < 2; ++c) {
-          dR_dF[2*c + r] = dU[r][c]*V.transpose() + U*dV[r][c].transpose();
-        }
-      }
-
-      // R, S, and the vector S
-      R = U * V.transpose();
-      Matrix2d S = R.transpose() * A;
-      s << S(0,0), S(1,1), 0.5*(S(1,0) + S(0,1));
-
-      for (int i = 0; i < 4; ++i) {
-        dRdF.col(i) = Vector4d(dR_dF[i].data());
-      }
-
-      // dS/dF where S is 2x2 flattened
-      Matrix4d J = sim::flatten_multiply<Matrix2d>(R.transpose()) *
-        (Matrix4d::Identity() - sim::flatten_multiply_right<Matrix2d>(S)*dRdF);
-
-      dsdF.row(0) = J.row(0);
-      dsdF.row(1) = J.row(3);
-      dsdF.row(2) = 0.5*(J.row(1) + J.row(2));
-    }
-  }
-}
-
 template<int DIM>
 double Stretch<DIM>::energy(const VectorXd& s) {
 
   double e = 0;
 
   #pragma omp parallel for reduction( + : e )
-  for (int i = 0; i < nelem_; ++i) {
-    const VecN& si = s.segment<N()>(N()*i);
-    double e_psi = mesh_->material_->energy(si) * mesh_->volumes()[i];
-    e += e_psi;
+  for (int b = 0; b < vols_.batches(); ++b) {
+    LaneMatrix<double,N(),1> S;
+    gather_stretches(b, s, S);
+
+    double psi[BATCH_WIDTH];
+    mesh_->material_->energy(S, psi);
+
+    const double* vol = vols_.batch(b)(0,0);
+    for (int l = 0; l < vols_.lanes(b); ++l) {
+      e += psi[l] * vol[l];
+    }
   }
   return e;
 }
@@ -96,26 +33,23 @@ template <int DIM>
 double Stretch<DIM>::constraint_value(const VectorXd& x,
     const VectorXd& s) {
 
-  VectorXd def_grad;
-  mesh_->deformation_gradient(x, def_grad);
-
   double e = 0;
-  Matrix<double,N(),M()> tmp;
 
   #pragma omp parallel for reduction( + : e )
-  for (int i = 0; i < nelem_; ++i) {
-
-    const VecM& F = def_grad.segment<M()>(M()*i);
-  
-    MatD R = R_[i];
-    VecN stmp;
-    polar_svd<DIM,N()>(R, stmp, Map<MatD>(def_grad.segment<M()>(M()*i).data()),
-        false, tmp);
-
-    const VecN& si = s.segment<N()>(N()*i);
-    VecN diff = Sym() * (stmp - si);
-    double e_l = la_.segment<N()>(N()*i).dot(diff) * mesh_->volumes()[i];
-    e += e_l;
+  for (int b = 0; b < R_.batches(); ++b) {
+    LaneMatrix<double,DIM,DIM> F;
+    gather_deformation_gradients(b, x, F);
+
+    LaneMatrix<double,DIM,DIM> R = R_.batch(b);
+    LaneMatrix<double,N(),1> stmp;
+    batch_polar(F, R, stmp);
+
+    for (int l = 0; l < R_.lanes(b); ++l) {
+      int i = BATCH_WIDTH*b + l;
+      const VecN& si = s.segment<N()>(N()*i);
+      VecN diff = Sym() * (stmp.get(l) - si);
+      e += la_.segment<N()>(N()*i).dot(diff) * vols_.batch(b)(0,0)[l];
+    }
   }
   return e;
 }
@@ -128,19 +62,29 @@ void Stretch<DIM>::update(const Eigen::VectorXd& x, double dt) {
 
 template<int DIM>
 void Stretch<DIM>::update_rotations(const Eigen::VectorXd& x) {
-  VectorXd def_grad;
-  mesh_->deformation_gradient(x, def_grad);
+  const VecN sym = Sym().diagonal();
 
-  #pragma omp parallel for 
-  for (int i = 0; i < nelem_; ++i) {
-    // Orthogonality sanity check
-    assert(R_[i].transpose()*R_[i] - MatD::Identity().norm() < 1e-6);
-
-    // TODO wrap newton procrustes in some sort of thing
-    Matrix<double, N(), M()> Js;
-    polar_svd<DIM,N()>(R_[i], S_[i],
-        Map<MatD>(def_grad.segment<M()>(M()*i).data()), true, Js);
-    dSdF_[i] = Js.transpose()*Sym();
+  #pragma omp parallel for
+  for (int b = 0; b < R_.batches(); ++b) {
+    LaneMatrix<double,DIM,DIM> F;
+    gather_deformation_gradients(b, x, F);
+
+    // Rotations are warm started from the previous solve
+    LaneMatrix<double,N(),M()> dsdF;
+    batch_polar(F, R_.batch(b), S_.batch(b), &dsdF);
+
+    // dS/dF = ds/dF^T * Sym
+    LaneMatrix<double,M(),N()>& dSdF = dSdF_.batch(b);
+    for (int c = 0; c < N(); ++c) {
+      for (int r = 0; r < M(); ++r) {
+        double* out = dSdF(r,c);
+        const double* in = dsdF(c,r);
+        #pragma omp simd
+        for (int l = 0; l < BATCH_WIDTH; ++l) {
+          out[l] = in[l] * sym(c);
+        }
+      }
+    }
   }
 }
 
@@ -148,105 +92,476 @@ template<int DIM>
 void Stretch<DIM>::update_derivatives(double dt) {
 
   double h2 = dt * dt;
+  const VecN sym = Sym().diagonal();
+  const VecN sym_inv = Syminv().diagonal();
 
   data_.timer.start("Hinv");
   #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-    double vol = mesh_->volumes()[i];
-    const VecN& si = s_.segment<N()>(N()*i);
-    MatN H = h2 * mesh_->material_->hessian(si);
-    Hinv_[i] = H.inverse();
-    g_[i] = h2 * mesh_->material_->gradient(si);
-    H_[i] = (1.0 / vol) * (Syminv() * H * Syminv());
+  for (int b = 0; b < H_.batches(); ++b) {
+    LaneMatrix<double,N(),N()>& H = H_.batch(b);
+    const double* vol = vols_.batch(b)(0,0);
+
+    LaneMatrix<double,N(),1> S;
+    gather_stretches(b, s_, S);
+    mesh_->material_->hessian(S, H);
+    mesh_->material_->gradient(S, g_.batch(b));
+
+    // Scale by h^2
+    for (int k = 0; k < N()*N(); ++k) {
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        H.v[k][l] *= h2;
+      }
+    }
+    for (int k = 0; k < N(); ++k) {
+      double* g = g_.batch(b).v[k];
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        g[l] *= h2;
+      }
+    }
+
+    // Padding lanes get an identity hessian so the batched inverse stays
+    // finite.
+    for (int l = H_.lanes(b); l < BATCH_WIDTH; ++l) {
+      H.set(l, MatN::Identity());
+    }
+    lane_inverse_spd(H, Hinv_.batch(b));
+
+    // H = (1/vol) * Syminv * H * Syminv
+    for (int c = 0; c < N(); ++c) {
+      for (int r = 0; r < N(); ++r) {
+        double* h = H(r,c);
+        double scale = sym_inv(r) * sym_inv(c);
+        #pragma omp simd
+        for (int l = 0; l < BATCH_WIDTH; ++l) {
+          h[l] *= scale / vol[l];
+        }
+      }
+    }
   }
   data_.timer.stop("Hinv");
-  
-  data_.timer.start("Local H");
-  const std::vector<MatrixXd>& Jloc = mesh_->local_jacobians();
+
+  if (!matrix_free_) {
+    update_lhs();
+  }
+
+  // Gradients with respect to the x and mixed variables
+  dSdF_v_.resize(M()*nelem_);
+  grad_.resize(N()*nelem_);
+
   #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-    double vol = mesh_->volumes()[i];
-    Aloc_[i] = (Jloc[i].transpose() * (dSdF_[i] * H_[i]
-        * dSdF_[i].transpose()) * Jloc[i]) * (vol*vol);
+  for (int b = 0; b < H_.batches(); ++b) {
+    LaneMatrix<double,N(),1> la, grad;
+    LaneMatrix<double,M(),1> dSdF_la;
+    lane_load(la_, b, nelem_, la);
+    lane_multiply(dSdF_.batch(b), la, dSdF_la);
+    lane_store(dSdF_la, b, nelem_, dSdF_v_);
+
+    // vol * (g + Sym * la)
+    const double* vol = vols_.batch(b)(0,0);
+    for (int r = 0; r < N(); ++r) {
+      const double* g = g_.batch(b)(r,0);
+      const double* la_r = la(r,0);
+      double* out = grad(r,0);
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        out[l] = vol[l] * (g[l] + sym(r) * la_r[l]);
+      }
+    }
+    lane_store(grad, b, nelem_, grad_);
+  }
+  grad_x_.resize(mesh_->jacobian().rows());
+  grad_x_.setZero();
+  grad_x_.noalias() -= mesh_->jacobian() * dSdF_v_;
+}
+
+template<int DIM>
+void Stretch<DIM>::update_lhs() {
+  assert(!matrix_free_);
+
+  data_.timer.start("Local H");
+  if (assembler_f_) {
+    update_local_lhs(Aloc_f_);
+  } else {
+    update_local_lhs(Aloc_);
   }
   data_.timer.stop("Local H");
-  //saveMarket(assembler_->A, "lhs2.mkt");
+
   data_.timer.start("Update LHS");
-  assembler_->update_matrix(Aloc_);
+  if (assembler_f_) {
+    assembler_f_->update_matrix(Aloc_f_);
+    if (config_->system_precision == SYSTEM_MIXED) {
+      A_ = assembler_f_->A.template cast<double>();
+    }
+  } else if (bsr_assembler_) {
+    bsr_assembler_->update_matrix(Aloc_);
+  } else {
+    assembler_->update_matrix(Aloc_);
+    A_ = assembler_->A;
+  }
   data_.timer.stop("Update LHS");
-  A_ = assembler_->A;
-
-  // Gradient with respect to x variable
-  grad_x_.resize(mesh_->jacobian().rows());
+}
 
-  VectorXd tmp(M()*nelem_);
+template<int DIM>
+template<typename Scalar>
+void Stretch<DIM>::update_local_lhs(ElementBlocks<Scalar>& Aloc) {
+  const ElementBlocks<double>& Jloc = mesh_->local_jacobians();
+  dispatch_element_size<DIM>(mesh_->T_.cols(), [&](auto size) {
+    constexpr int K = decltype(size)::value;
+
+    if constexpr (K == Eigen::Dynamic) {
+      #pragma omp parallel for
+      for (int i = 0; i < nelem_; ++i) {
+        double vol = vols_[i](0);
+        MatMN dSdF = dSdF_[i];
+        Map<const MatrixXd> J = Jloc.block(i);
+        Aloc.block(i) = ((J.transpose() * (dSdF * H_[i]
+            * dSdF.transpose()) * J) * (vol*vol)).template cast<Scalar>();
+      }
+    } else {
+      // vol^2 * J^T (dSdF H dSdF^T) J for a full group of elements
+      #pragma omp parallel for
+      for (int b = 0; b < H_.batches(); ++b) {
+        LaneMatrix<double,M(),N()> dSdFH;
+        LaneMatrix<double,M(),M()> W;
+        lane_multiply(dSdF_.batch(b), H_.batch(b), dSdFH);
+        lane_multiply_transpose(dSdFH, dSdF_.batch(b), W);
+
+        LaneMatrix<double,M(),K> J, WJ;
+        LaneMatrix<double,K,K> A;
+        gather_jacobians(b, J);
+        lane_multiply(W, J, WJ);
+        lane_transpose_multiply(J, WJ, A);
+
+        const double* vol = vols_.batch(b)(0,0);
+        for (int l = 0; l < H_.lanes(b); ++l) {
+          Scalar* out = Aloc.template block<K,K>(BATCH_WIDTH*b + l).data();
+          double vol2 = vol[l] * vol[l];
+          for (int j = 0; j < K*K; ++j) {
+            out[j] = static_cast<Scalar>(A.v[j][l] * vol2);
+          }
+        }
+      }
+    }
+  });
+}
 
-  #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-    tmp.segment<M()>(M()*i) = dSdF_[i]*la_.segment<N()>(N()*i);
+template<int DIM>
+template<int K>
+void Stretch<DIM>::gather_jacobians(int b, LaneMatrix<double,M(),K>& J) {
+  const ElementBlocks<double>& Jloc = mesh_->local_jacobians();
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    int i = BATCH_WIDTH*b + l;
+    if (i < nelem_) {
+      J.set(l, Jloc.block<M(),K>(i));
+    } else {
+      J.set(l, Matrix<double,M(),K>::Zero());
+    }
   }
-  grad_x_ = -mesh_->jacobian() * tmp;
+}
 
-  // Gradient with respect to mixed variable
-  grad_.resize(N()*nelem_);
+template<int DIM>
+void Stretch<DIM>::gather_deformation_gradients(int b, const VectorXd& x,
+    LaneMatrix<double,DIM,DIM>& F) {
+  for (int l = 0; l < BATCH_WIDTH; ++l) {
+    int i = BATCH_WIDTH*b + l;
+    if (i < nelem_) {
+      VecM Fi = mesh_->template element_deformation_gradient<DIM>(i, x);
+      F.set(l, Map<MatD>(Fi.data()));
+    } else {
+      F.set(l, MatD::Identity());
+    }
+  }
+}
 
-  #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-    double vol = mesh_->volumes()[i];
-    grad_.segment<N()>(N()*i) = vol * (g_[i] + Sym()*la_.segment<N()>(N()*i));
+template<int DIM>
+void Stretch<DIM>::gather_stretches(int b, const VectorXd& s,
+    LaneMatrix<double,N(),1>& S) {
+  lane_load(s, b, nelem_, S);
+  for (int l = vols_.lanes(b); l < BATCH_WIDTH; ++l) {
+    S.set(l, Ivec());
   }
 }
 
 template<int DIM>
-VectorXd Stretch<DIM>::rhs() {
+void Stretch<DIM>::apply_lhs(const VectorXd& x, VectorXd& y) {
+  data_.timer.start("Apply LHS");
+  const ElementBlocks<double>& Jloc = mesh_->local_jacobians();
+  const std::vector<int>& free_map = mesh_->free_map_;
+  const MatrixXi& T = mesh_->T_;
+
+  // Per element: vol^2 * Jloc^T dSdF H dSdF^T Jloc * x_e, applied
+  // right to left so only vectors are formed.
+  dispatch_element_size<DIM>(T.cols(), [&](auto size) {
+    constexpr int K = decltype(size)::value;
+
+    if constexpr (K == Eigen::Dynamic) {
+      // Jloc * x_e is accumulated node by node so every intermediate is
+      // a fixed size vector on the stack
+      #pragma omp parallel for
+      for (int i = 0; i < nelem_; ++i) {
+        double vol = vols_[i](0);
+        VecM Jx = VecM::Zero();
+        for (int j = 0; j < T.cols(); ++j) {
+          int id = free_map[T(i,j)];
+          if (id != -1) {
+            Jx.noalias() += Jloc.block(i).middleCols<DIM>(DIM*j)
+                * x.segment<DIM>(DIM*id);
+          }
+        }
+        MatMN dSdF = dSdF_[i];
+        VecN w = dSdF.transpose() * Jx;
+        w = (vol*vol) * (H_[i] * w);
+        VecM dSdFw = dSdF * w;
+        yloc_.block(i).noalias() = Jloc.block(i).transpose() * dSdFw;
+      }
+    } else {
+      #pragma omp parallel for
+      for (int b = 0; b < H_.batches(); ++b) {
+        LaneMatrix<double,K,1> xe, ye;
+        for (int l = 0; l < BATCH_WIDTH; ++l) {
+          int i = BATCH_WIDTH*b + l;
+          for (int j = 0; j < K / DIM; ++j) {
+            int id = (i < nelem_) ? free_map[T(i,j)] : -1;
+            for (int d = 0; d < DIM; ++d) {
+              xe(DIM*j + d, 0)[l] = (id != -1) ? x(DIM*id + d) : 0.0;
+            }
+          }
+        }
+
+        LaneMatrix<double,M(),K> J;
+        LaneMatrix<double,M(),1> Jx, dSdFw;
+        LaneMatrix<double,N(),1> w, Hw;
+        gather_jacobians(b, J);
+        lane_multiply(J, xe, Jx);
+        lane_transpose_multiply(dSdF_.batch(b), Jx, w);
+        lane_multiply(H_.batch(b), w, Hw);
+
+        const double* vol = vols_.batch(b)(0,0);
+        for (int r = 0; r < N(); ++r) {
+          double* hw = Hw(r,0);
+          #pragma omp simd
+          for (int l = 0; l < BATCH_WIDTH; ++l) {
+            hw[l] *= vol[l] * vol[l];
+          }
+        }
+        lane_multiply(dSdF_.batch(b), Hw, dSdFw);
+        lane_transpose_multiply(J, dSdFw, ye);
+
+        for (int l = 0; l < H_.lanes(b); ++l) {
+          yloc_.block<K,1>(BATCH_WIDTH*b + l) = ye.get(l);
+        }
+      }
+    }
+  });
+
+  vec_assembler_->assemble(yloc_, Ay_);
+  y += Ay_;
+  data_.timer.stop("Apply LHS");
+}
+
+template<int DIM>
+const VectorXd& Stretch<DIM>::rhs() {
   data_.timer.start("RHS - s");
 
-  rhs_.resize(mesh_->jacobian().rows());
-  rhs_.setZero();
+  const VecN sym = Sym().diagonal();
+  const VecN sym_inv = Syminv().diagonal();
   gl_.resize(N()*nelem_);
+  dSdF_v_.resize(M()*nelem_);
 
-  VectorXd tmp(M()*nelem_);
   #pragma omp parallel for
-  for (int i = 0; i < nelem_; ++i) {
-    double vol = mesh_->volumes()[i];
-    const VecN& si = s_.segment<N()>(N()*i);
-    gl_.segment<N()>(N()*i) = vol * H_[i] * Sym() * (S_[i] - si)
-        + Syminv() * g_[i];
-    tmp.segment<M()>(M()*i) = dSdF_[i] * gl_.segment<N()>(N()*i);
+  for (int b = 0; b < H_.batches(); ++b) {
+    LaneMatrix<double,N(),1> s, diff, gl;
+    LaneMatrix<double,M(),1> dSdF_gl;
+    lane_load(s_, b, nelem_, s);
+
+    // gl = vol * H * Sym * (S - s) + Syminv * g
+    for (int r = 0; r < N(); ++r) {
+      const double* S = S_.batch(b)(r,0);
+      const double* s_r = s(r,0);
+      double* d = diff(r,0);
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        d[l] = sym(r) * (S[l] - s_r[l]);
+      }
+    }
+    lane_multiply(H_.batch(b), diff, gl);
+
+    const double* vol = vols_.batch(b)(0,0);
+    for (int r = 0; r < N(); ++r) {
+      const double* g = g_.batch(b)(r,0);
+      double* gl_r = gl(r,0);
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        gl_r[l] = vol[l] * gl_r[l] + sym_inv(r) * g[l];
+      }
+    }
+    lane_store(gl, b, nelem_, gl_);
+
+    lane_multiply(dSdF_.batch(b), gl, dSdF_gl);
+    lane_store(dSdF_gl, b, nelem_, dSdF_v_);
   }
-  rhs_ = -mesh_->jacobian() * tmp;
+  rhs_.resize(mesh_->jacobian().rows());
+  rhs_.setZero();
+  rhs_.noalias() -= mesh_->jacobian() * dSdF_v_;
   data_.timer.stop("RHS - s");
   return rhs_;
 }
 
 template<int DIM>
-VectorXd Stretch<DIM>::gradient() {
+const VectorXd& Stretch<DIM>::gradient() {
   return grad_x_;
 }
 
 template<int DIM>
-VectorXd Stretch<DIM>::gradient_mixed() {
+const VectorXd& Stretch<DIM>::gradient_mixed() {
   return grad_;
 }
 
 template<int DIM>
 void Stretch<DIM>::solve(const VectorXd& dx) {
   data_.timer.start("local");
-  Jdx_ = -mesh_->jacobian().transpose() * dx;
-  la_ = -gl_;
+  Jdx_.resize(mesh_->jacobian().cols());
+  Jdx_.setZero();
+  Jdx_.noalias() -= mesh_->jacobian().transpose() * dx;
 
+  const VecN sym = Sym().diagonal();
+  la_.resize(N()*nelem_);
   ds_.resize(N()*nelem_);
 
-  #pragma omp parallel for 
-  for (int i = 0; i < nelem_; ++i) {
-    la_.segment<N()>(N()*i) += H_[i] * (dSdF_[i].transpose()
-        * Jdx_.segment<M()>(M()*i));
-    ds_.segment<N()>(N()*i) = -Hinv_[i]
-        * (Sym() * la_.segment<N()>(N()*i) + g_[i]);
+  #pragma omp parallel for
+  for (int b = 0; b < H_.batches(); ++b) {
+    LaneMatrix<double,M(),1> Jdx;
+    LaneMatrix<double,N(),1> gl, w, la, r, ds;
+    lane_load(Jdx_, b, nelem_, Jdx);
+    lane_load(gl_, b, nelem_, gl);
+
+    // la = -gl + H * dSdF^T * Jdx
+    lane_transpose_multiply(dSdF_.batch(b), Jdx, w);
+    lane_multiply(H_.batch(b), w, la);
+
+    // ds = -Hinv * (Sym * la + g)
+    for (int i = 0; i < N(); ++i) {
+      const double* g = g_.batch(b)(i,0);
+      const double* gl_i = gl(i,0);
+      double* la_i = la(i,0);
+      double* r_i = r(i,0);
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        la_i[l] -= gl_i[l];
+        r_i[l] = -(sym(i) * la_i[l] + g[l]);
+      }
+    }
+    lane_multiply(Hinv_.batch(b), r, ds);
+
+    lane_store(la, b, nelem_, la_);
+    lane_store(ds, b, nelem_, ds_);
   }
   data_.timer.stop("local");
 }
 
+template<int DIM>
+void Stretch<DIM>::linesearch_begin(const VectorXd& x, const VectorXd& dx) {
+  linear_F_ = mesh_->T_.cols() == DIM + 1;
+  if (!linear_F_) {
+    ls_x_ = x;
+    ls_dx_ = dx;
+    return;
+  }
+
+  F0_.resize(nelem_);
+  dF_.resize(nelem_);
+
+  #pragma omp parallel for
+  for (int b = 0; b < F0_.batches(); ++b) {
+    gather_deformation_gradients(b, x, F0_.batch(b));
+    gather_deformation_gradients(b, dx, dF_.batch(b));
+    for (int l = F0_.lanes(b); l < BATCH_WIDTH; ++l) {
+      dF_.batch(b).set(l, MatD::Zero());
+    }
+  }
+}
+
+template<int DIM>
+void Stretch<DIM>::linesearch_values(const double* alpha, int n, double h2,
+    double* f) {
+  assert(n <= MAX_LINESEARCH_CANDIDATES);
+  const VecN sym = Sym().diagonal();
+
+  // Objective of group b at step length a, given the trial deformation
+  // gradients F
+  auto group_value = [&](int b, const LaneMatrix<double,DIM,DIM>& F,
+      double a) {
+    // Stretches of the trial deformation, warm started from the rotations
+    // at the start of the search
+    LaneMatrix<double,DIM,DIM> R = R_.batch(b);
+    LaneMatrix<double,N(),1> sF;
+    batch_polar(F, R, sF);
+
+    // Trial mixed variables s + a * ds
+    LaneMatrix<double,N(),1> s, ds, la;
+    gather_stretches(b, s_, s);
+    lane_load(ds_, b, nelem_, ds);
+    lane_load(la_, b, nelem_, la);
+    for (int k = 0; k < N(); ++k) {
+      #pragma omp simd
+      for (int l = 0; l < BATCH_WIDTH; ++l) {
+        s.v[k][l] += a * ds.v[k][l];
+      }
+    }
+
+    double psi[BATCH_WIDTH];
+    mesh_->material_->energy(s, psi);
+
+    // h2 * psi - la^T Sym (S(F) - s), weighted by volume
+    double e = 0;
+    const double* vol = vols_.batch(b)(0,0);
+    for (int l = 0; l < vols_.lanes(b); ++l) {
+      double c = 0;
+      for (int k = 0; k < N(); ++k) {
+        c += la(k,0)[l] * sym(k) * (sF(k,0)[l] - s(k,0)[l]);
+      }
+      e += (h2 * psi[l] - c) * vol[l];
+    }
+    return e;
+  };
+
+  if (linear_F_) {
+    double e[MAX_LINESEARCH_CANDIDATES] = {};
+
+    #pragma omp parallel for reduction( + : e )
+    for (int b = 0; b < R_.batches(); ++b) {
+      const LaneMatrix<double,DIM,DIM>& F0 = F0_.batch(b);
+      const LaneMatrix<double,DIM,DIM>& dF = dF_.batch(b);
+      for (int j = 0; j < n; ++j) {
+        LaneMatrix<double,DIM,DIM> F;
+        for (int k = 0; k < M(); ++k) {
+          #pragma omp simd
+          for (int l = 0; l < BATCH_WIDTH; ++l) {
+            F.v[k][l] = F0.v[k][l] + alpha[j] * dF.v[k][l];
+          }
+        }
+        e[j] += group_value(b, F, alpha[j]);
+      }
+    }
+    std::copy(e, e + n, f);
+  } else {
+    for (int j = 0; j < n; ++j) {
+      ls_xa_ = ls_x_ + alpha[j] * ls_dx_;
+      double e = 0;
+
+      #pragma omp parallel for reduction( + : e )
+      for (int b = 0; b < R_.batches(); ++b) {
+        LaneMatrix<double,DIM,DIM> F;
+        gather_deformation_gradients(b, ls_xa_, F);
+        e += group_value(b, F, alpha[j]);
+      }
+      f[j] = e;
+    }
+  }
+}
+
 template<int DIM>
 void Stretch<DIM>::reset() {
   nelem_ = mesh_->T_.rows();
@@ -254,30 +569,104 @@ void Stretch<DIM>::reset() {
   s_.resize(N()*nelem_);
   la_.resize(N()*nelem_);
   la_.setZero();
+
+  // Padding lanes hold identity/zero state and unit volumes
   R_.resize(nelem_);
   S_.resize(nelem_);
   H_.resize(nelem_);
   g_.resize(nelem_);
   dSdF_.resize(nelem_);
   Hinv_.resize(nelem_);
-  Aloc_.resize(nelem_);
-  assembler_ = std::make_shared<Assembler<double,DIM,-1>>(
-      mesh_->T_, mesh_->free_map_);
+  vols_.resize(nelem_);
+  R_.fill(MatD::Identity());
+  S_.fill(Ivec());
+  H_.fill(MatN::Identity());
+  g_.fill(VecN::Zero());
+  dSdF_.fill(MatMN::Zero());
+  Hinv_.fill(MatN::Identity());
+  vols_.fill(Matrix<double,1,1>::Ones());
+
+  int k = DIM*mesh_->T_.cols();
+  yloc_.resize(nelem_, k);
+
+  // Reduced precision modes form and assemble the element blocks in float.
+  // In single precision mode the assembled LHS stays in float as well.
+  // Matrix-free systems need neither.
+  assembler_ = nullptr;
+  assembler_f_ = nullptr;
+  bsr_assembler_ = nullptr;
+  A_ = SparseMatrix<double, RowMajor>();
+  if (matrix_free_) {
+    Aloc_ = ElementBlocks<double>();
+    Aloc_f_ = ElementBlocks<float>();
+  } else if (config_->system_precision == SYSTEM_DOUBLE) {
+    Aloc_.resize(nelem_, k, k);
+    if (config_->block_storage) {
+      bsr_assembler_ = std::make_shared<BSRAssembler<double,DIM,-1>>(
+          mesh_->T_, mesh_->free_map_);
+    } else {
+      assembler_ = std::make_shared<Assembler<double,DIM,-1>>(
+          mesh_->T_, mesh_->free_map_, config_->symmetric_storage);
+    }
+  } else {
+    Aloc_f_.resize(nelem_, k, k);
+    assembler_f_ = std::make_shared<Assembler<float,DIM,-1>>(
+        mesh_->T_, mesh_->free_map_, config_->symmetric_storage);
+  }
+  vec_assembler_ = std::make_shared<VecAssembler<double,DIM,-1>>(mesh_->T_,
+      mesh_->free_map_, true);
 
   #pragma omp parallel for
   for (int i = 0; i < nelem_; ++i) {
-    R_[i].setIdentity();
-    H_[i].setIdentity();
-    Hinv_[i].setIdentity();
-    g_[i].setZero();
-    S_[i] = Ivec();
+    vols_.set(i, Matrix<double,1,1>(mesh_->volumes()[i]));
     s_.segment<N()>(N()*i) = Ivec();
   }
 }
 
+template<int DIM>
+void Stretch<DIM>::predict(const VectorXd& x) {
+  update_rotations(x);
+
+  #pragma omp parallel for
+  for (int b = 0; b < S_.batches(); ++b) {
+    lane_store(S_.batch(b), b, nelem_, s_);
+  }
+}
+
+template<int DIM>
+void Stretch<DIM>::save_state(Checkpoint& ckpt) const {
+  MatrixXd R(DIM*DIM, nelem_);
+  for (int i = 0; i < nelem_; ++i) {
+    R.col(i) = R_[i].reshaped();
+  }
+  ckpt.set("s", s_);
+  ckpt.set("la", la_);
+  ckpt.set("R", R);
+}
+
+template<int DIM>
+bool Stretch<DIM>::load_state(const Checkpoint& ckpt) {
+  VectorXd s, la;
+  MatrixXd R;
+  if (!ckpt.get("s", s) || s.size() != s_.size()
+      || !ckpt.get("la", la) || la.size() != la_.size()
+      || !ckpt.get("R", R) || R.rows() != DIM*DIM || R.cols() != nelem_) {
+    return false;
+  }
+
+  s_ = s;
+  la_ = la;
+  for (int i = 0; i < nelem_; ++i) {
+    R_.set(i, R.col(i).reshaped(DIM, DIM));
+  }
+  return true;
+}
+
 template<int DIM>
 void Stretch<DIM>::post_solve() {
-  la_.setZero();
+  if (!config_->warm_start_multipliers) {
+    la_.setZero();
+  }
 }
 
 template class mfem::Stretch<3>; // 3D
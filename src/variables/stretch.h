@@ -3,9 +3,13 @@
 #include "mixed_variable.h"
 #include "optimizers/optimizer_data.h"
 #include "sparse_utils.h"
+#include "batch_matrix.h"
+#include "checkpoint.h"
 
 namespace mfem {
 
+  class SimConfig;
+
   // Variable for DIMxDIM symmetric deformation stretch matrix
   // from polar decomposition of deformation gradient (F = RS) 
   template<int DIM>
@@ -15,7 +19,9 @@ namespace mfem {
 
   public:
 
-    Stretch(std::shared_ptr<Mesh> mesh) : MixedVariable<DIM>(mesh)
+    Stretch(std::shared_ptr<Mesh> mesh,
+        std::shared_ptr<SimConfig> config)
+        : MixedVariable<DIM>(mesh), config_(config)
     {}
 
     double energy(const Eigen::VectorXd& s) override;
@@ -25,16 +31,57 @@ namespace mfem {
     void reset() override;
     void post_solve() override;
 
-    Eigen::VectorXd rhs() override;
-    Eigen::VectorXd gradient() override;
-    Eigen::VectorXd gradient_mixed() override;
+    // Saves the stretches, multipliers and the rotations the next polar
+    // decompositions are warm started from
+    void save_state(Checkpoint& ckpt) const;
+
+    // Restores the state saved by save_state(). Call after reset().
+    // Returns false if the checkpoint doesn't match this variable.
+    bool load_state(const Checkpoint& ckpt);
+
+    // Resets the stretches to those of the deformation x, so the mixed
+    // variables start consistent with predicted positions
+    void predict(const Eigen::VectorXd& x);
+
+    const Eigen::VectorXd& rhs() override;
+    const Eigen::VectorXd& gradient() override;
+    const Eigen::VectorXd& gradient_mixed() override;
 
     const Eigen::SparseMatrix<double, Eigen::RowMajor>& lhs() override {
       return A_;
     }
 
+    // LHS in block storage. Only assembled if block_storage is enabled,
+    // in which case lhs() is left empty.
+    const BSRMatrix<double,DIM>& lhs_bsr() const {
+      assert(bsr_assembler_);
+      return bsr_assembler_->A;
+    }
+
+    // LHS in single precision. Only assembled if system_precision is
+    // SYSTEM_SINGLE, in which case lhs() is left empty.
+    const Eigen::SparseMatrix<float, Eigen::RowMajor>& lhs_single() const {
+      assert(assembler_f_);
+      return assembler_f_->A;
+    }
+
     void solve(const Eigen::VectorXd& dx) override;
 
+    void linesearch_begin(const Eigen::VectorXd& x,
+        const Eigen::VectorXd& dx) override;
+    void linesearch_values(const double* alpha, int n, double h2,
+        double* f) override;
+
+    // If enabled, update() skips assembling lhs() and the system is
+    // only available through apply_lhs(). Call before reset(), which then
+    // skips allocating the per-element blocks and assemblers.
+    void set_matrix_free(bool matrix_free) {
+      matrix_free_ = matrix_free;
+    }
+
+    // Adds lhs() * x to y using the per-element blocks
+    void apply_lhs(const Eigen::VectorXd& x, Eigen::VectorXd& y);
+
     Eigen::VectorXd& delta() override {
       return ds_;
     }
@@ -52,6 +99,14 @@ namespace mfem {
     void update_rotations(const Eigen::VectorXd& x);
     void update_derivatives(double dt);
 
+    // Form per-element blocks and assemble the LHS
+    void update_lhs();
+
+    // Per-element LHS blocks stored in the given precision. The material
+    // derivatives they are formed from are always evaluated in double.
+    template<typename Scalar>
+    void update_local_lhs(ElementBlocks<Scalar>& Aloc);
+
   private:
 
     // Number of degrees of freedom per element
@@ -104,6 +159,19 @@ namespace mfem {
       return m;
     }
 
+    // Deformation gradients of the elements in lane group b (identity for
+    // padding)
+    void gather_deformation_gradients(int b, const Eigen::VectorXd& x,
+        LaneMatrix<double,DIM,DIM>& F);
+
+    // Stretches of the elements in lane group b (identity for padding)
+    void gather_stretches(int b, const Eigen::VectorXd& s,
+        LaneMatrix<double,N(),1>& S);
+
+    // Local jacobians of the elements in lane group b (zero for padding)
+    template<int K>
+    void gather_jacobians(int b, LaneMatrix<double,M(),K>& J);
+
     using Base::mesh_;
 
     OptimizerData data_;      // Stores timing results
@@ -116,14 +184,38 @@ namespace mfem {
     Eigen::VectorXd grad_x_;  // Gradient with respect to 'x' variables
     Eigen::VectorXd gl_;      // tmp var: g_\Lambda in the notes
     Eigen::VectorXd Jdx_;     // tmp var: Jacobian multiplied by dx
-    std::vector<MatD> R_;     // per-element rotations
-    std::vector<VecN> S_;     // per-element deformation
-    std::vector<VecN> g_;     // per-element gradients
-    std::vector<MatN> H_;     // per-element hessians
-    std::vector<MatN> Hinv_;  // per-element hessian inverse
-    std::vector<MatMN> dSdF_; 
-    std::vector<Eigen::MatrixXd> Aloc_;
+    Eigen::VectorXd dSdF_v_;  // tmp var: per-element dSdF products
+    Eigen::VectorXd Ay_;      // tmp var: assembled apply_lhs() products
+
+    // Per-element state in structure-of-arrays layout, processed in lane
+    // groups of BATCH_WIDTH elements
+    BatchMatrix<double,DIM,DIM> R_;     // per-element rotations
+    BatchMatrix<double,N(),1> S_;       // per-element deformation
+    BatchMatrix<double,N(),1> g_;       // per-element gradients
+    BatchMatrix<double,N(),N()> H_;     // per-element hessians
+    BatchMatrix<double,N(),N()> Hinv_;  // per-element hessian inverse
+    BatchMatrix<double,M(),N()> dSdF_;
+    BatchMatrix<double,1,1> vols_;      // per-element volumes
+
+    // Line search state. For elements whose deformation gradient is
+    // linear in x, trial deformation gradients are F0_ + alpha * dF_.
+    // Otherwise they are evaluated from ls_x_ + alpha * ls_dx_.
+    BatchMatrix<double,DIM,DIM> F0_;
+    BatchMatrix<double,DIM,DIM> dF_;
+    bool linear_F_ = true;
+    Eigen::VectorXd ls_x_;
+    Eigen::VectorXd ls_dx_;
+    Eigen::VectorXd ls_xa_;
+
+    ElementBlocks<double> Aloc_;        // per-element LHS blocks
+    ElementBlocks<float> Aloc_f_;       // single precision LHS blocks
+    ElementBlocks<double> yloc_;        // per-element products for apply_lhs
+    bool matrix_free_ = false;
     Eigen::SparseMatrix<double, Eigen::RowMajor> A_;
+    std::shared_ptr<SimConfig> config_;
     std::shared_ptr<Assembler<double,DIM,-1>> assembler_;
+    std::shared_ptr<Assembler<float,DIM,-1>> assembler_f_;
+    std::shared_ptr<BSRAssembler<double,DIM,-1>> bsr_assembler_;
+    std::shared_ptr<VecAssembler<double,DIM,-1>> vec_assembler_;
   };
 }
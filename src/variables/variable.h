@@ -7,6 +7,10 @@ namespace mfem {
 
   class Mesh;
 
+  // Maximum number of step lengths the variables evaluate in one pass
+  // over the elements during a line search
+  constexpr int MAX_LINESEARCH_CANDIDATES = 8;
+
   // Base class for fem degrees of freedom.
   template<int DIM>
   class Variable {
@@ -30,11 +34,12 @@ namespace mfem {
     virtual void post_solve() = 0;
 
     // Build and return the right-hand-side of schur-complement
-    // reduced system of equations
-    virtual Eigen::VectorXd rhs() = 0;
+    // reduced system of equations. Returned vectors are buffers owned by
+    // the variable, reused across calls and only valid until the next one.
+    virtual const Eigen::VectorXd& rhs() = 0;
 
     // Gradient of the energy
-    virtual Eigen::VectorXd gradient() = 0;
+    virtual const Eigen::VectorXd& gradient() = 0;
 
     // Left-hand-side of the system
     virtual const Eigen::SparseMatrix<double, Eigen::RowMajor>& lhs() = 0;
@@ -0,0 +1,272 @@
+#include "catch2/catch.hpp"
+#include "sparse_utils.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // Two tetrahedra sharing a face, plus one dangling element
+  MatrixXi test_elements() {
+    MatrixXi E(3,4);
+    E << 0, 1, 2, 3,
+         1, 2, 3, 4,
+         3, 4, 5, 6;
+    return E;
+  }
+
+  // Reference dense assembly of per-element blocks
+  MatrixXd dense_assembly(const MatrixXi& E, const std::vector<int>& free_map,
+      const std::vector<MatrixXd>& blocks, int DIM) {
+    int m = *std::max_element(free_map.begin(), free_map.end()) + 1;
+    MatrixXd A = MatrixXd::Zero(DIM*m, DIM*m);
+    for (int e = 0; e < E.rows(); ++e) {
+      for (int j = 0; j < E.cols(); ++j) {
+        for (int k = 0; k < E.cols(); ++k) {
+          int id1 = free_map[E(e,j)];
+          int id2 = free_map[E(e,k)];
+          if (id1 != -1 && id2 != -1) {
+            A.block(DIM*id1, DIM*id2, DIM, DIM) +=
+                blocks[e].block(DIM*j, DIM*k, DIM, DIM);
+          }
+        }
+      }
+    }
+    return A;
+  }
+
+}
+
+TEST_CASE("Assembler - update_matrix") {
+  MatrixXi E = test_elements();
+  std::vector<int> free_map = {0, -1, 1, 2, 3, -1, 4};
+
+  std::vector<MatrixXd> blocks(E.rows());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    blocks[i] = MatrixXd::Random(12,12);
+  }
+
+  Assembler<double,3,-1> assembler(E, free_map);
+  assembler.update_matrix(blocks);
+
+  MatrixXd A = assembler.A;
+  MatrixXd A_ref = dense_assembly(E, free_map, blocks, 3);
+  CHECK((A - A_ref).norm() < 1e-12);
+
+  // Repeated updates overwrite rather than accumulate
+  assembler.update_matrix(blocks);
+  A = assembler.A;
+  CHECK((A - A_ref).norm() < 1e-12);
+}
+
+TEST_CASE("Assembler - upper triangular storage") {
+  MatrixXi E = test_elements();
+  std::vector<int> free_map = {0, -1, 1, 2, 3, -1, 4};
+
+  std::vector<MatrixXd> blocks(E.rows());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    MatrixXd B = MatrixXd::Random(12,12);
+    blocks[i] = B + B.transpose();
+  }
+
+  Assembler<double,3,-1> assembler(E, free_map, true);
+  assembler.update_matrix(blocks);
+
+  MatrixXd A_ref = dense_assembly(E, free_map, blocks, 3);
+  MatrixXd A_upper = assembler.A;
+  CHECK((A_upper - MatrixXd(A_ref.triangularView<Upper>())).norm() < 1e-12);
+
+  SparseMatrix<double, RowMajor> A_full = assembler.A.selfadjointView<Upper>();
+  MatrixXd A = A_full;
+  CHECK((A - A_ref).norm() < 1e-12);
+}
+
+TEST_CASE("BlockMatrixAssembler - update") {
+  int n = 12;
+  int nblocks = 3;
+
+  MatrixXd Ad = MatrixXd::Random(n,n);
+  Ad = (Ad + Ad.transpose()).eval();
+  SparseMatrix<double, RowMajor> A = Ad.sparseView();
+
+  MatrixXd Bd = MatrixXd::Zero(6*nblocks, n);
+  for (int i = 0; i < nblocks; ++i) {
+    Bd.block(6*i, 3*i, 6, 6).setRandom();
+  }
+  SparseMatrix<double, RowMajor> B = Bd.sparseView();
+
+  std::vector<Matrix<double,6,6>> C(nblocks);
+  for (int i = 0; i < nblocks; ++i) {
+    C[i].setRandom();
+  }
+
+  SparseMatrix<double, RowMajor> mat;
+  BlockMatrixAssembler<6,RowMajor,RowMajor,RowMajor> assembler(A, B, C, mat);
+
+  // New values on the same sparsity
+  A.coeffs().setRandom();
+  B.coeffs().setRandom();
+  for (int i = 0; i < nblocks; ++i) {
+    C[i].setRandom();
+  }
+  assembler.update(A, B, C, mat);
+
+  SparseMatrix<double, RowMajor> ref;
+  fill_block_matrix(A, B, C, ref);
+  MatrixXd diff = MatrixXd(mat) - MatrixXd(ref);
+  CHECK(diff.norm() < 1e-12);
+}
+
+TEST_CASE("VecAssembler - colored and gather modes") {
+  MatrixXi E = test_elements();
+  std::vector<int> free_map = {0, -1, 1, 2, 3, -1, 4};
+
+  std::vector<Matrix<double,12,1>> vecs(E.rows());
+  for (size_t i = 0; i < vecs.size(); ++i) {
+    vecs[i].setRandom();
+  }
+
+  // Reference assembly
+  VectorXd a_ref = VectorXd::Zero(15);
+  for (int e = 0; e < E.rows(); ++e) {
+    for (int j = 0; j < E.cols(); ++j) {
+      int id = free_map[E(e,j)];
+      if (id != -1) {
+        a_ref.segment<3>(3*id) += vecs[e].segment<3>(3*j);
+      }
+    }
+  }
+
+  VecAssembler<double,3,4> gather(E, free_map);
+  VectorXd a;
+  gather.assemble(vecs, a);
+  CHECK((a - a_ref).norm() < 1e-12);
+  CHECK(gather.num_colors() == 0);
+
+  VecAssembler<double,3,4> colored(E, free_map, true);
+  colored.assemble(vecs, a);
+  CHECK((a - a_ref).norm() < 1e-12);
+
+  // No two elements of the same color share a free node
+  for (int c = 0; c < colored.num_colors(); ++c) {
+    std::vector<int> count(5, 0);
+    for (int i = colored.color_offsets[c]; i < colored.color_offsets[c+1];
+        ++i) {
+      int e = colored.color_elements[i];
+      for (int j = 0; j < E.cols(); ++j) {
+        int id = free_map[E(e,j)];
+        if (id != -1) {
+          CHECK(++count[id] == 1);
+        }
+      }
+    }
+  }
+  CHECK(colored.color_offsets.back() == E.rows());
+}
+
+TEST_CASE("BSRAssembler - products and conversion") {
+  MatrixXi E = test_elements();
+  std::vector<int> free_map = {0, -1, 1, 2, 3, -1, 4};
+
+  std::vector<MatrixXd> blocks(E.rows());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    blocks[i] = MatrixXd::Random(12,12);
+  }
+
+  BSRAssembler<double,3,-1> assembler(E, free_map);
+  assembler.update_matrix(blocks);
+  const BSRMatrix<double,3>& A = assembler.A;
+
+  MatrixXd A_ref = dense_assembly(E, free_map, blocks, 3);
+  MatrixXd A_csr = A.to_csr();
+  CHECK((A_csr - A_ref).norm() < 1e-12);
+
+  VectorXd x = VectorXd::Random(A.cols());
+  VectorXd y;
+  A.multiply(x, y);
+  CHECK((y - A_ref*x).norm() < 1e-12);
+  A.transpose_multiply(x, y);
+  CHECK((y - A_ref.transpose()*x).norm() < 1e-12);
+  CHECK((A.diagonal() - A_ref.diagonal()).norm() < 1e-12);
+
+  std::vector<Matrix3d> diag;
+  A.block_diagonal(diag);
+  for (int i = 0; i < A.block_rows(); ++i) {
+    CHECK((diag[i] - A_ref.block<3,3>(3*i,3*i)).norm() < 1e-12);
+  }
+
+  // 9x fewer column indices than scalar storage
+  CHECK(9 * A.inner_index().size() == A.to_csr().nonZeros());
+
+  // Contiguous element blocks
+  ElementBlocks<double> eblocks;
+  eblocks.resize(E.rows(), 12, 12);
+  for (int i = 0; i < eblocks.size(); ++i) {
+    eblocks.block(i) = blocks[i];
+  }
+  BSRAssembler<double,3,-1> eassembler(E, free_map);
+  eassembler.update_matrix(eblocks);
+  A_csr = eassembler.A.to_csr();
+  CHECK((A_csr - A_ref).norm() < 1e-12);
+
+  // Scalar matrices within the block pattern and sums of block matrices
+  SparseMatrix<double, RowMajor> D(A.rows(), A.cols());
+  D.setIdentity();
+  BSRMatrix<double,3> B = A;
+  B.set_values(D);
+  B += A;
+  A_csr = B.to_csr();
+  CHECK((A_csr - A_ref - MatrixXd(D)).norm() < 1e-12);
+}
+
+TEST_CASE("Assembler - contiguous element blocks") {
+  MatrixXi E = test_elements();
+  std::vector<int> free_map = {0, -1, 1, 2, 3, -1, 4};
+
+  ElementBlocks<double> blocks;
+  blocks.resize(E.rows(), 12, 12);
+  std::vector<MatrixXd> blocks_ref(E.rows());
+  std::vector<Matrix<double,12,12>> blocks_fixed(E.rows());
+  for (int i = 0; i < blocks.size(); ++i) {
+    blocks.block<12,12>(i).setRandom();
+    blocks_ref[i] = blocks.block(i);
+    blocks_fixed[i] = blocks.block(i);
+  }
+  MatrixXd A_ref = dense_assembly(E, free_map, blocks_ref, 3);
+
+  Assembler<double,3,-1> assembler(E, free_map);
+  assembler.update_matrix(blocks);
+  MatrixXd A = assembler.A;
+  CHECK((A - A_ref).norm() < 1e-12);
+
+  Assembler<double,3,4> fixed_assembler(E, free_map);
+  fixed_assembler.update_matrix(blocks_fixed);
+  A = fixed_assembler.A;
+  CHECK((A - A_ref).norm() < 1e-12);
+
+  // Element vectors
+  ElementBlocks<double> vecs;
+  vecs.resize(E.rows(), 12);
+  std::vector<Matrix<double,12,1>> vecs_fixed(E.rows());
+  for (int i = 0; i < vecs.size(); ++i) {
+    vecs.block<12,1>(i).setRandom();
+    vecs_fixed[i] = vecs.block(i);
+  }
+  VecAssembler<double,3,-1> vec_assembler(E, free_map, true);
+  VecAssembler<double,3,4> vec_assembler_fixed(E, free_map);
+  VectorXd a, a_ref;
+  vec_assembler.assemble(vecs, a);
+  vec_assembler_fixed.assemble(vecs_fixed, a_ref);
+  CHECK((a - a_ref).norm() < 1e-12);
+
+  // Tetrahedra and triangles get fixed size kernels
+  int size = 0;
+  dispatch_element_size<3>(4, [&](auto n) { size = decltype(n)::value; });
+  CHECK(size == 12);
+  dispatch_element_size<3>(3, [&](auto n) { size = decltype(n)::value; });
+  CHECK(size == 9);
+  dispatch_element_size<2>(3, [&](auto n) { size = decltype(n)::value; });
+  CHECK(size == 6);
+  dispatch_element_size<3>(2, [&](auto n) { size = decltype(n)::value; });
+  CHECK(size == Eigen::Dynamic);
+}
@@ -0,0 +1,60 @@
+#include "catch2/catch.hpp"
+#include "batch_matrix.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("BatchMatrix - lane kernels") {
+  constexpr int W = BATCH_WIDTH;
+  int n = 3*W - 1; // last group is padded
+
+  BatchMatrix<double,9,6> A;
+  BatchMatrix<double,6,6> H;
+  A.resize(n);
+  H.resize(n);
+  CHECK(A.batches() == 3);
+  CHECK(A.lanes(2) == W - 1);
+
+  std::vector<Matrix<double,9,6>> A_ref(n);
+  std::vector<Matrix<double,6,6>> H_ref(n);
+  for (int i = 0; i < n; ++i) {
+    A_ref[i].setRandom();
+    Matrix<double,6,6> B = Matrix<double,6,6>::Random();
+    H_ref[i] = B * B.transpose() + Matrix<double,6,6>::Identity();
+    A.set(i, A_ref[i]);
+    H.set(i, H_ref[i]);
+  }
+  H.batch(2).set(W - 1, Matrix<double,6,6>::Identity());
+
+  for (int b = 0; b < A.batches(); ++b) {
+    LaneMatrix<double,9,6> AH;
+    LaneMatrix<double,9,9> AHAt;
+    LaneMatrix<double,6,6> AtA, Hinv;
+    lane_multiply(A.batch(b), H.batch(b), AH);
+    lane_multiply_transpose(AH, A.batch(b), AHAt);
+    lane_transpose_multiply(A.batch(b), A.batch(b), AtA);
+    lane_inverse_spd(H.batch(b), Hinv);
+
+    for (int l = 0; l < A.lanes(b); ++l) {
+      int i = W*b + l;
+      Matrix<double,9,9> AHAt_ref = A_ref[i] * H_ref[i]
+          * A_ref[i].transpose();
+      CHECK((AHAt.get(l) - AHAt_ref).norm() < 1e-10 * AHAt_ref.norm());
+      CHECK((AtA.get(l) - A_ref[i].transpose()*A_ref[i]).norm() < 1e-10);
+      CHECK((Hinv.get(l) - H_ref[i].inverse()).norm() < 1e-10);
+    }
+  }
+
+  // Gather and scatter of per-element vector segments
+  VectorXd x = VectorXd::Random(6*n);
+  VectorXd y = VectorXd::Zero(6*n);
+  for (int b = 0; b < A.batches(); ++b) {
+    LaneMatrix<double,6,1> xb;
+    lane_load(x, b, n, xb);
+    for (int l = 0; l < A.lanes(b); ++l) {
+      CHECK((xb.get(l) - x.segment<6>(6*(W*b + l))).norm() == 0);
+    }
+    lane_store(xb, b, n, y);
+  }
+  CHECK((x - y).norm() == 0);
+}
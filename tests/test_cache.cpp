@@ -0,0 +1,145 @@
+#include "catch2/catch.hpp"
+#include "precompute_cache.h"
+#include "linear_solvers/cached_ordering.h"
+#include <Eigen/SparseCholesky>
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("Precompute cache - round trip") {
+  std::string path = "test_cache_roundtrip.bin";
+  uint64_t key = hash_bytes(path.data(), path.size());
+
+  MatrixXd A = MatrixXd::Random(5,3);
+  VectorXd a = VectorXd::Random(7);
+  SparseMatrix<double, RowMajor> S = MatrixXd(MatrixXd::Random(6,6)
+      .cwiseMax(0)).sparseView();
+  ElementBlocks<double> blocks;
+  blocks.resize(2, 9, 12);
+  blocks.block(0) = MatrixXd::Random(9,12);
+  blocks.block(1) = MatrixXd::Random(9,12);
+  std::vector<int> ids = {3, 1, 4, 1, 5};
+
+  CacheWriter writer(path, key);
+  writer.write(A);
+  writer.write(a);
+  writer.write(S);
+  writer.write(blocks);
+  writer.write(ids);
+  REQUIRE(writer.commit());
+
+  {
+    CacheReader reader(path, key);
+    REQUIRE(reader.good());
+
+    MatrixXd A2;
+    VectorXd a2;
+    SparseMatrix<double, RowMajor> S2;
+    ElementBlocks<double> blocks2;
+    std::vector<int> ids2;
+    CHECK(reader.read(A2));
+    CHECK(reader.read(a2));
+    CHECK(reader.read(S2));
+    CHECK(reader.read(blocks2));
+    CHECK(reader.read(ids2));
+    CHECK(A2 == A);
+    CHECK(a2 == a);
+    CHECK(MatrixXd(S2) == MatrixXd(S));
+    REQUIRE(blocks2.size() == 2);
+    CHECK(blocks2.block(1) == blocks.block(1));
+    CHECK(ids2 == ids);
+
+    // Reading past the end invalidates the reader
+    CHECK(!reader.read(A2));
+    CHECK(!reader.good());
+  }
+
+  // Different key is a cache miss
+  CacheReader stale(path, key + 1);
+  CHECK(!stale.good());
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Precompute cache - corrupt length") {
+  std::string path = "test_cache_corrupt.bin";
+  uint64_t key = hash_bytes(path.data(), path.size());
+
+  std::vector<double> v = {1.0, 2.0, 3.0};
+  CacheWriter writer(path, key);
+  writer.write(v);
+  REQUIRE(writer.commit());
+
+  // Overwrite the array length with one whose byte count wraps around to
+  // the size of the stored data
+  uint64_t n = (1ull << 61) + v.size();
+  FILE* file = std::fopen(path.c_str(), "r+b");
+  REQUIRE(file != nullptr);
+  std::fseek(file, -static_cast<long>(sizeof(n) + sizeof(double) * v.size()),
+      SEEK_END);
+  std::fwrite(&n, sizeof(n), 1, file);
+  std::fclose(file);
+
+  {
+    CacheReader reader(path, key);
+    REQUIRE(reader.good());
+    std::vector<double> v2;
+    CHECK(!reader.read(v2));
+    CHECK(!reader.good());
+  }
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Precompute cache - corrupt sparse structure") {
+  std::string path = "test_cache_sparse.bin";
+  uint64_t key = hash_bytes(path.data(), path.size());
+
+  // 3x3 row major matrix with 4 nonzeros
+  int64_t dims[2] = {3, 3};
+  std::vector<double> values = {1.0, 2.0, 3.0, 4.0};
+  auto read_sparse = [&](const std::vector<int>& outer,
+      const std::vector<int>& inner) {
+    CacheWriter writer(path, key);
+    writer.write(dims, 2);
+    writer.write(outer);
+    writer.write(inner);
+    writer.write(values);
+    REQUIRE(writer.commit());
+
+    CacheReader reader(path, key);
+    SparseMatrix<double, RowMajor> S;
+    return reader.read(S);
+  };
+
+  CHECK(read_sparse({0, 1, 3, 4}, {0, 1, 2, 2}));
+  // Outer indices not monotone
+  CHECK(!read_sparse({0, 3, 1, 4}, {0, 1, 2, 2}));
+  // Outer indices not ending at nnz
+  CHECK(!read_sparse({0, 1, 3, 3}, {0, 1, 2, 2}));
+  // Inner index out of range
+  CHECK(!read_sparse({0, 1, 3, 4}, {0, 1, 3, 2}));
+  CHECK(!read_sparse({0, 1, 3, 4}, {0, -1, 2, 2}));
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Precompute cache - cached ordering") {
+  int n = 30;
+  MatrixXd B = MatrixXd::Random(n,n);
+  MatrixXd D = B.transpose()*B + n*MatrixXd::Identity(n,n);
+  SparseMatrix<double> A = D.sparseView(0.5, 1.0);
+  A = SparseMatrix<double>(A.transpose()) + A;
+  A.diagonal().array() += 4*n;
+  VectorXd b = VectorXd::Random(n);
+
+  SimplicialLLT<SparseMatrix<double>, Lower, CachedAMDOrdering<int>> llt1;
+  llt1.compute(A);
+  VectorXd x1 = llt1.solve(b);
+
+  // Second solver reuses the stored ordering
+  SimplicialLLT<SparseMatrix<double>, Lower, CachedAMDOrdering<int>> llt2;
+  llt2.compute(A);
+  VectorXd x2 = llt2.solve(b);
+
+  CHECK(llt1.permutationP().indices() == llt2.permutationP().indices());
+  CHECK((A*x2 - b).norm() < 1e-8);
+  CHECK((x1 - x2).norm() < 1e-12);
+}
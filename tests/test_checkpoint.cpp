@@ -0,0 +1,81 @@
+#include "catch2/catch.hpp"
+#include "checkpoint.h"
+#include "time_integrators/BDF.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("Checkpoint - round trip") {
+  std::string path = "test_checkpoint_roundtrip.bin";
+
+  Checkpoint ckpt;
+  ckpt.step = 42;
+  ckpt.time = 1.428;
+  ckpt.key = 7;
+  VectorXd x = VectorXd::Random(11);
+  MatrixXd R = MatrixXd::Random(9,5);
+  ckpt.set("x", x);
+  ckpt.set("R", R);
+  REQUIRE(write_checkpoint(path, ckpt));
+
+  Checkpoint read;
+  REQUIRE(read_checkpoint(path, 7, read));
+  CHECK(read.step == 42);
+  CHECK(read.time == 1.428);
+  VectorXd x2;
+  MatrixXd R2;
+  CHECK(read.get("x", x2));
+  CHECK(read.get("R", R2));
+  CHECK(x2 == x);
+  CHECK(R2 == R);
+  CHECK(!read.get("la", x2));
+
+  // Checkpoints of other simulations are rejected
+  Checkpoint other;
+  CHECK(!read_checkpoint(path, 8, other));
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Checkpoint - background writes") {
+  std::string path = "test_checkpoint_async.bin";
+  VectorXd x = VectorXd::Random(100);
+
+  CheckpointWriter writer;
+  for (int i = 1; i <= 3; ++i) {
+    Checkpoint ckpt;
+    ckpt.step = i;
+    ckpt.set("x", i * x);
+    writer.write(path, std::move(ckpt));
+  }
+  REQUIRE(writer.wait());
+
+  // Writes complete in order, so the last one is on disk
+  Checkpoint read;
+  REQUIRE(read_checkpoint(path, 0, read));
+  VectorXd x2;
+  CHECK(read.step == 3);
+  CHECK(read.get("x", x2));
+  CHECK(x2 == 3 * x);
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Checkpoint - integrator history") {
+  int n = 6;
+  BDF<2> bdf(VectorXd::Zero(n), VectorXd::Ones(n), 0.01);
+  for (int i = 0; i < 3; ++i) {
+    bdf.update(VectorXd::Random(n));
+  }
+  bdf.set_timestep(0.02);
+
+  Checkpoint ckpt;
+  bdf.save_state(ckpt);
+
+  BDF<2> restored(VectorXd::Zero(n), VectorXd::Zero(n), 0.01);
+  REQUIRE(restored.load_state(ckpt));
+  CHECK(restored.h() == bdf.h());
+  CHECK(restored.x_tilde() == bdf.x_tilde());
+
+  // Histories of different lengths don't match
+  BDF<3> bdf3(VectorXd::Zero(n), VectorXd::Zero(n), 0.01);
+  CHECK(!bdf3.load_state(ckpt));
+}
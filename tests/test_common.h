@@ -3,7 +3,7 @@
 #include "finitediff.hpp"
 #include "igl/readMESH.h"
 //#include "simulator.h"
-#include "optimizers/mixed_alm_optimizer.h"
+#include "config.h"
 #include "energies/stable_neohookean.h"
 #include "mesh/tet_mesh.h"
 
@@ -13,7 +13,31 @@ namespace Test {
   using namespace mfem;
   using namespace fd;
 
-  template <class T = MixedALMOptimizer>
+  // Two tetrahedra sharing a face, with no fixed vertices
+  inline std::shared_ptr<Mesh> two_tets() {
+    MatrixXd V(5,3);
+    V << 0, 0, 0,
+         1, 0, 0,
+         0, 1, 0,
+         0, 0, 1,
+         1, 1, 1;
+    MatrixXi T(2,4);
+    T << 0, 1, 2, 3,
+         1, 2, 3, 4;
+
+    std::shared_ptr<MaterialConfig> material_config =
+        std::make_shared<MaterialConfig>();
+    std::shared_ptr<MaterialModel> material =
+        std::make_shared<StableNeohookean>(material_config);
+    std::shared_ptr<Mesh> mesh = std::make_shared<TetrahedralMesh>(V, T,
+        material, material_config);
+    mesh->update_free_map();
+    mesh->init();
+    return mesh;
+  }
+
+  // Steps the optimizer T once on the two tet mesh
+  template <class T>
   struct App {
 
     App() {
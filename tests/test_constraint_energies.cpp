@@ -1,4 +1,3 @@
-#define CATCH_CONFIG_MAIN
 #include "catch2/catch.hpp"
 #include "test_common.h"
 #include "svd/dsvd.h"
@@ -0,0 +1,143 @@
+#include "catch2/catch.hpp"
+#include "frame_cache.h"
+#include <filesystem>
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // Positions of a mesh drifting by small random steps
+  std::vector<MatrixXd> random_walk(int frames, int vertices, int dim) {
+    std::vector<MatrixXd> V(frames);
+    V[0] = MatrixXd::Random(vertices, dim);
+    for (int i = 1; i < frames; ++i) {
+      V[i] = V[i-1] + 1e-3 * MatrixXd::Random(vertices, dim);
+    }
+    return V;
+  }
+
+  std::vector<Frame> read_all(const std::string& path) {
+    FrameCacheReader reader(path);
+    REQUIRE(reader.good());
+    std::vector<Frame> frames;
+    Frame frame;
+    while (reader.next(frame)) {
+      frames.push_back(frame);
+    }
+    return frames;
+  }
+}
+
+TEST_CASE("Frame cache - encodings") {
+  std::string path = "test_frame_cache.bin";
+  int nframes = 40, nv = 50;
+  MatrixXi T = MatrixXi::Random(20, 4).unaryExpr(
+      [&](int i) { return std::abs(i) % nv; });
+  MatrixXd V0 = MatrixXd::Random(nv, 3);
+  std::vector<MatrixXd> V = random_walk(nframes, nv, 3);
+
+  FrameCacheOptions options;
+  options.keyframe_interval = 8;
+  options.max_pending = 4;
+
+  auto record = [&](FrameEncoding encoding) {
+    options.encoding = encoding;
+    FrameCacheWriter writer(path, V0, T, options);
+    for (int i = 0; i < nframes; ++i) {
+      writer.write(i, 0.01 * i, V[i]);
+    }
+    REQUIRE(writer.close());
+    return std::filesystem::file_size(path);
+  };
+
+  SECTION("Double") {
+    record(FRAME_DOUBLE);
+    FrameCacheReader reader(path);
+    REQUIRE(reader.good());
+    CHECK(reader.elements() == T);
+    CHECK(reader.rest_positions() == V0);
+    CHECK(reader.vertices() == nv);
+    CHECK(reader.dim() == 3);
+    CHECK(reader.frames() == nframes);
+
+    std::vector<Frame> frames = read_all(path);
+    REQUIRE(int(frames.size()) == nframes);
+    for (int i = 0; i < nframes; ++i) {
+      CHECK(frames[i].step == i);
+      CHECK(frames[i].time == 0.01 * i);
+      CHECK(frames[i].V == V[i]);
+    }
+  }
+
+  SECTION("Float") {
+    record(FRAME_FLOAT);
+    std::vector<Frame> frames = read_all(path);
+    REQUIRE(int(frames.size()) == nframes);
+    for (int i = 0; i < nframes; ++i) {
+      CHECK((frames[i].V - V[i]).lpNorm<Infinity>() < 1e-6);
+    }
+  }
+
+  SECTION("Quantized") {
+    size_t raw = record(FRAME_DOUBLE);
+    size_t quantized = record(FRAME_QUANTIZED);
+    CHECK(quantized < raw / 3);
+
+    // Errors don't accumulate across delta frames
+    std::vector<Frame> frames = read_all(path);
+    REQUIRE(int(frames.size()) == nframes);
+    for (int i = 0; i < nframes; ++i) {
+      CHECK((frames[i].V - V[i]).lpNorm<Infinity>()
+          <= 0.5 * options.quantum + 1e-12);
+    }
+  }
+
+  SECTION("Random access") {
+    record(FRAME_QUANTIZED);
+    FrameCacheReader reader(path);
+    REQUIRE(reader.frames() == nframes);
+    CHECK(reader.step(17) == 17);
+    CHECK(reader.time(17) == 0.01 * 17);
+
+    // Backwards, forwards across keyframes and repeated frames
+    Frame frame;
+    for (int i : {37, 3, 11, 12, 12, 31, 0, 39}) {
+      REQUIRE(reader.read(i, frame));
+      CHECK(frame.step == i);
+      CHECK((frame.V - V[i]).lpNorm<Infinity>()
+          <= 0.5 * options.quantum + 1e-12);
+    }
+    CHECK(!reader.read(nframes, frame));
+    CHECK(!reader.next(frame));
+  }
+
+  SECTION("Refresh") {
+    // Frames appended while the file is open show up after refresh()
+    options.encoding = FRAME_QUANTIZED;
+    FrameCacheWriter writer(path, V0, T, options);
+    FrameCacheReader reader(path);
+    REQUIRE(reader.good());
+    CHECK(reader.frames() == 0);
+
+    for (int i = 0; i < 12; ++i) {
+      writer.write(i, 0.01 * i, V[i]);
+    }
+    REQUIRE(writer.close());
+    CHECK(reader.refresh() == 12);
+    Frame frame;
+    REQUIRE(reader.read(11, frame));
+    CHECK((frame.V - V[11]).lpNorm<Infinity>()
+        <= 0.5 * options.quantum + 1e-12);
+  }
+
+  SECTION("Truncated") {
+    // A frame cut off mid-write is skipped
+    size_t size = record(FRAME_QUANTIZED);
+    std::filesystem::resize_file(path, size - 10);
+    std::vector<Frame> frames = read_all(path);
+    CHECK(int(frames.size()) == nframes - 1);
+  }
+
+  std::remove(path.c_str());
+}
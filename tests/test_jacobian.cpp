@@ -29,6 +29,28 @@ TEST_CASE("Tet Jacobian - dF/dx") {
   CHECK(compare_jacobian(grad.transpose(), fgrad));
 }
 
+TEST_CASE("Tet Jacobian - fused deformation gradient") {
+  MatrixXd meshV;
+  MatrixXi meshF, meshT;
+  igl::readMESH("../models/two_tets.mesh", meshV, meshT, meshF);
+
+  std::shared_ptr<MaterialConfig> material_config =
+      std::make_shared<MaterialConfig>();
+  std::shared_ptr<MaterialModel> material =
+      std::make_shared<StableNeohookean>(material_config);
+  TetrahedralMesh mesh(meshV, meshT, material, material_config);
+  mesh.init();
+
+  VectorXd x = VectorXd::Random(meshV.size());
+  VectorXd def_grad;
+  mesh.deformation_gradient(x, def_grad);
+
+  for (int i = 0; i < meshT.rows(); ++i) {
+    Vector9d F = mesh.element_deformation_gradient<3>(i, x);
+    CHECK((F - def_grad.segment<9>(9*i)).norm() < 1e-10);
+  }
+}
+
 TEST_CASE("Tri Jacobian - dF/dx") {
   std::shared_ptr<SimConfig> config;
   std::shared_ptr<MaterialConfig> material_config;
@@ -0,0 +1,58 @@
+#include "catch2/catch.hpp"
+#include "linear_solvers/eigen_solver.h"
+#include "linear_solvers/lagged_solver.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("LaggedSolver - factorization reuse") {
+  int n = 60;
+  MatrixXd B = MatrixXd::Random(n,n);
+  MatrixXd Ad = B * B.transpose() + n * MatrixXd::Identity(n,n);
+  MatrixXd Dd = MatrixXd::Random(n,n);
+  Dd = Dd * Dd.transpose();
+  VectorXd b = VectorXd::Random(n);
+
+  using LLT = SimplicialLLT<SparseMatrix<double, RowMajor>>;
+  using Solver = mfem::EigenSolver<LLT, double, RowMajor>;
+  double tol = 1e-8;
+  LaggedSolver<RowMajor> solver(std::make_unique<Solver>(), false, 0.1, 20,
+      tol);
+
+  auto check = [&](const MatrixXd& Ad, bool reused) {
+    SparseMatrix<double, RowMajor> A = Ad.sparseView();
+    solver.compute(A);
+    VectorXd x = solver.solve(b);
+    CHECK(solver.reused_factorization() == reused);
+    CHECK((Ad * x - b).norm() < 10 * tol * b.norm());
+  };
+
+  // First system is factorized
+  check(Ad, false);
+  CHECK(solver.misses() == 1);
+
+  // Small changes reuse the factorization
+  check(Ad + 1e-3 * Dd, true);
+  check(Ad + 2e-3 * Dd, true);
+  CHECK(solver.hits() == 2);
+  CHECK(solver.misses() == 1);
+
+  // Large changes are refactorized
+  check(2 * Ad, false);
+  CHECK(solver.misses() == 2);
+
+  SECTION("Upper triangular storage") {
+    using LLTUpper = SimplicialLLT<SparseMatrix<double, RowMajor>, Upper>;
+    LaggedSolver<RowMajor> upper(
+        std::make_unique<mfem::EigenSolver<LLTUpper, double, RowMajor>>(),
+        true, 0.1, 20, tol);
+    SparseMatrix<double, RowMajor> A0 = Ad.sparseView();
+    SparseMatrix<double, RowMajor> A1 = MatrixXd(Ad + 1e-3 * Dd).sparseView();
+    upper.compute(A0.triangularView<Upper>());
+    upper.solve(b);
+    upper.compute(A1.triangularView<Upper>());
+    VectorXd x = upper.solve(b);
+    CHECK(upper.reused_factorization());
+    CHECK((A1 * x - b).norm() < 10 * tol * b.norm());
+  }
+}
@@ -0,0 +1,100 @@
+#include "catch2/catch.hpp"
+#include "test_common.h"
+#include "config.h"
+#include "variables/displacement.h"
+#include "variables/stretch.h"
+#include "time_integrators/implicit_integrator.h"
+#include "linesearch.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("Line search - cached objective") {
+  std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+  std::shared_ptr<Mesh> mesh = Test::two_tets();
+
+  auto xvar = std::make_shared<Displacement<3>>(mesh, config);
+  auto svar = std::make_shared<Stretch<3>>(mesh, config);
+  xvar->reset();
+  svar->reset();
+
+  double h2 = std::pow(xvar->integrator()->dt(), 2);
+  xvar->value() += 0.05 * VectorXd::Random(xvar->value().size());
+  xvar->delta() = 0.05 * VectorXd::Random(xvar->value().size());
+  svar->delta() = 0.05 * VectorXd::Random(svar->value().size());
+  svar->lambda() = VectorXd::Random(svar->value().size());
+
+  VectorXd x, dx;
+  xvar->unproject(xvar->value(), x);
+  xvar->unproject_delta(xvar->delta(), dx);
+  svar->update(x, xvar->integrator()->dt());
+
+  SECTION("Mixed") {
+    xvar->linesearch_begin(x, dx);
+    svar->linesearch_begin(x, dx);
+
+    for (double alpha : {0.0, 0.25, 1.0}) {
+      VectorXd xa = xvar->value() + alpha * xvar->delta();
+      VectorXd sa = svar->value() + alpha * svar->delta();
+      VectorXd xa_full;
+      xvar->unproject(xa, xa_full);
+      double f = xvar->energy(xa) + h2 * svar->energy(sa)
+          - svar->constraint_value(xa_full, sa);
+      double f_ls = xvar->linesearch_value(alpha)
+          + svar->linesearch_value(alpha, h2);
+      CHECK(f_ls == Approx(f).epsilon(1e-8));
+    }
+  }
+
+  SECTION("Multiple step lengths per pass") {
+    xvar->linesearch_begin(x, dx);
+    svar->linesearch_begin(x, dx);
+
+    double alpha[4] = {0.0, 1.0, 0.5, 0.25};
+    double fx[4], fs[4];
+    xvar->linesearch_values(alpha, 4, fx);
+    svar->linesearch_values(alpha, 4, h2, fs);
+    for (int j = 0; j < 4; ++j) {
+      CHECK(fx[j] == Approx(xvar->linesearch_value(alpha[j])));
+      CHECK(fs[j] == Approx(svar->linesearch_value(alpha[j], h2)));
+    }
+  }
+
+  SECTION("Unmixed") {
+    xvar->set_mixed(false);
+    xvar->linesearch_begin(x, dx);
+
+    for (double alpha : {0.0, 0.25, 1.0}) {
+      VectorXd xa = xvar->value() + alpha * xvar->delta();
+      CHECK(xvar->linesearch_value(alpha)
+          == Approx(xvar->energy(xa)).epsilon(1e-10));
+    }
+  }
+
+  SECTION("Speculative evaluation counts") {
+    std::vector<std::shared_ptr<MixedVariable<3>>> vars = {svar};
+    LinesearchWorkspace ws;
+    LinesearchStats stats;
+    double alpha = 1.0;
+    linesearch_speculative(xvar, vars, ws, alpha, 12, stats);
+
+    // f(0) and three candidates per pass. The sequential baseline
+    // evaluates at most the same step lengths, one per pass.
+    CHECK(stats.evaluations == 1 + 3 * stats.passes);
+    CHECK(stats.wasted <= 3 * stats.passes);
+    CHECK(stats.saved >= 0);
+    CHECK(stats.saved + stats.passes <= stats.evaluations);
+  }
+
+  SECTION("Sequential evaluation counts") {
+    std::vector<std::shared_ptr<MixedVariable<3>>> vars = {svar};
+    LinesearchWorkspace ws;
+    LinesearchStats stats;
+    double alpha = 1.0;
+    linesearch_backtracking_cubic(xvar, vars, ws, alpha, 12, stats);
+
+    CHECK(stats.evaluations == stats.passes);
+    CHECK(stats.wasted == 0);
+    CHECK(stats.saved == 0);
+  }
+}
@@ -0,0 +1,78 @@
+#include "catch2/catch.hpp"
+#include "config.h"
+#include "energies/stable_neohookean.h"
+#include "energies/neohookean.h"
+#include "energies/corotational.h"
+#include "energies/arap.h"
+#include "energies/fung.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // Compares the batched evaluations of a model against its per-element
+  // ones on stretches near the identity. Tolerances are relative to each
+  // element's result, whose magnitude varies widely between models.
+  template <int N, typename Vec = Matrix<double,N,1>>
+  void check_batch(MaterialModel& model, const Vec& I) {
+    LaneMatrix<double,N,1> S;
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      S.set(l, Vec(I + 0.1 * Vec::Random()));
+    }
+
+    double e[BATCH_WIDTH];
+    LaneMatrix<double,N,1> g;
+    LaneMatrix<double,N,N> H;
+    model.energy(S, e);
+    model.gradient(S, g);
+    model.hessian(S, H);
+
+    for (int l = 0; l < BATCH_WIDTH; ++l) {
+      Vec Sl = S.get(l);
+      Vec g_ref = model.gradient(Sl);
+      Matrix<double,N,N> H_ref = model.hessian(Sl);
+      CHECK(e[l] == Approx(model.energy(Sl)));
+      CHECK((g.get(l) - g_ref).norm() <= 1e-10 * g_ref.norm());
+      CHECK((H.get(l) - H_ref).norm() <= 1e-8 * H_ref.norm());
+    }
+  }
+}
+
+TEST_CASE("Material models - batched evaluation") {
+  std::shared_ptr<MaterialConfig> config = std::make_shared<MaterialConfig>();
+  Vector6d I6 = (Vector6d() << 1,1,1,0,0,0).finished();
+  Vector3d I3 = (Vector3d() << 1,1,0).finished();
+  Vector9d I9 = (Vector9d() << 1,0,0,0,1,0,0,0,1).finished();
+  Vector4d I4 = (Vector4d() << 1,0,0,1).finished();
+
+  SECTION("Stable-Neohookean") {
+    StableNeohookean model(config);
+    check_batch<6>(model, I6);
+    check_batch<9>(model, I9);
+    check_batch<3>(model, I3);
+    check_batch<4>(model, I4);
+  }
+
+  SECTION("Neohookean") {
+    Neohookean model(config);
+    check_batch<6>(model, I6);
+    check_batch<9>(model, I9);
+  }
+
+  SECTION("Corotational") {
+    Corotational model(config);
+    check_batch<6>(model, I6);
+  }
+
+  SECTION("ARAP") {
+    ArapModel model(config);
+    check_batch<6>(model, I6);
+    check_batch<3>(model, I3);
+  }
+
+  SECTION("Fung") {
+    Fung model(config);
+    check_batch<6>(model, I6);
+  }
+}
@@ -0,0 +1,70 @@
+#include "catch2/catch.hpp"
+#include "test_common.h"
+#include "alloc_counter.h"
+#include "config.h"
+#include "linear_solvers/pcg.h"
+#include "variables/stretch.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // Stretch LHS as a standalone operator
+  class StretchOperator : public LinearOperator<double> {
+  public:
+    StretchOperator(std::shared_ptr<Stretch<3>> svar, int n)
+        : svar_(svar), n_(n) {}
+
+    int rows() const override { return n_; }
+    int cols() const override { return n_; }
+
+    void apply(const VectorXd& x, VectorXd& y) const override {
+      y.setZero(n_);
+      svar_->apply_lhs(x, y);
+    }
+
+  private:
+    std::shared_ptr<Stretch<3>> svar_;
+    int n_;
+  };
+}
+
+TEST_CASE("Stretch - matrix-free products") {
+  std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+  std::shared_ptr<Mesh> mesh = Test::two_tets();
+
+  auto assembled = std::make_shared<Stretch<3>>(mesh, config);
+  auto matrix_free = std::make_shared<Stretch<3>>(mesh, config);
+  matrix_free->set_matrix_free(true);
+  assembled->reset();
+  matrix_free->reset();
+
+  MatrixXd Vt = mesh->V0_.transpose();
+  VectorXd x = Map<VectorXd>(Vt.data(), Vt.size())
+      + 0.05 * VectorXd::Random(Vt.size());
+  assembled->update(x, config->h);
+  matrix_free->update(x, config->h);
+
+  // The matrix-free variable never assembles its LHS
+  CHECK(matrix_free->lhs().nonZeros() == 0);
+
+  const SparseMatrix<double, RowMajor>& A = assembled->lhs();
+  VectorXd dx = VectorXd::Random(A.cols());
+  VectorXd y = VectorXd::Zero(A.rows());
+  matrix_free->apply_lhs(dx, y);
+  VectorXd y_ref = A * dx;
+  CHECK((y - y_ref).norm() < 1e-10 * y_ref.norm());
+
+  // Once the outputs are sized, products allocate nothing
+  StretchOperator op(matrix_free, A.rows());
+  VectorXd y_op = y;
+  {
+    NoAllocationScope guard("Matrix-free products");
+    y.setZero();
+    matrix_free->apply_lhs(dx, y);
+    pcg_multiply(op, dx, y_op);
+  }
+  CHECK((y - y_ref).norm() < 1e-10 * y_ref.norm());
+  CHECK((y_op - y_ref).norm() < 1e-10 * y_ref.norm());
+}
@@ -0,0 +1,76 @@
+#include "catch2/catch.hpp"
+#include "sparse_utils.h"
+#include "linear_solvers/eigen_solver.h"
+#include "linear_solvers/single_precision_solver.h"
+
+using namespace Eigen;
+using namespace mfem;
+
+TEST_CASE("Assembler - single precision blocks") {
+  MatrixXi E(2,4);
+  E << 0, 1, 2, 3,
+       1, 2, 3, 4;
+  std::vector<int> free_map = {0, 1, -1, 2, 3};
+
+  ElementBlocks<double> blocks;
+  ElementBlocks<float> blocks_f;
+  blocks.resize(E.rows(), 12, 12);
+  blocks_f.resize(E.rows(), 12, 12);
+  for (int i = 0; i < E.rows(); ++i) {
+    blocks.block<12,12>(i).setRandom();
+    blocks_f.block<12,12>(i) = blocks.block<12,12>(i).cast<float>();
+  }
+
+  Assembler<double,3,-1> assembler(E, free_map);
+  Assembler<float,3,-1> assembler_f(E, free_map);
+  assembler.update_matrix(blocks);
+  assembler_f.update_matrix(blocks_f);
+
+  MatrixXd A = assembler.A;
+  MatrixXd A_f = MatrixXf(assembler_f.A).cast<double>();
+  CHECK((A - A_f).norm() < 1e-5 * A.norm());
+}
+
+TEST_CASE("SinglePrecisionSolver - refinement") {
+  int n = 60;
+  MatrixXd B = MatrixXd::Random(n,n);
+  MatrixXd Ad = B * B.transpose() + n * MatrixXd::Identity(n,n);
+  SparseMatrix<double, RowMajor> A = Ad.sparseView();
+  VectorXd b = VectorXd::Random(n);
+  VectorXd x_ref = Ad.llt().solve(b);
+
+  using LLTf = SimplicialLLT<SparseMatrix<float, RowMajor>>;
+  using Solverf = mfem::EigenSolver<LLTf, float, RowMajor>;
+
+  // Without refinement the solution is only accurate to single precision
+  SinglePrecisionSolver<RowMajor> unrefined(std::make_unique<Solverf>(),
+      false, 0);
+  unrefined.compute(A);
+  double err0 = (unrefined.solve(b) - x_ref).norm() / x_ref.norm();
+  CHECK(err0 < 1e-4);
+
+  SinglePrecisionSolver<RowMajor> solver(std::make_unique<Solverf>(),
+      false, 2);
+  solver.compute(A);
+  double err = (solver.solve(b) - x_ref).norm() / x_ref.norm();
+  CHECK(err < 1e-10);
+
+  // Upper triangular storage
+  SparseMatrix<double, RowMajor> A_upper = A.triangularView<Upper>();
+  using LLTfUpper = SimplicialLLT<SparseMatrix<float, RowMajor>, Upper>;
+  using SolverfUpper = mfem::EigenSolver<LLTfUpper, float, RowMajor>;
+  SinglePrecisionSolver<RowMajor> solver_upper(
+      std::make_unique<SolverfUpper>(), true, 2);
+  solver_upper.compute(A_upper);
+  err = (solver_upper.solve(b) - x_ref).norm() / x_ref.norm();
+  CHECK(err < 1e-10);
+
+  // Systems assembled in float are solved as is, so the refined solution
+  // converges to that of the float system
+  SparseMatrix<float, RowMajor> A_f = A_upper.cast<float>();
+  SparseMatrix<double, RowMajor> A_fd = A_f.cast<double>();
+  solver_upper.compute_single(A_f);
+  VectorXd x = solver_upper.solve(b);
+  VectorXd r = b - A_fd.selfadjointView<Upper>() * x;
+  CHECK(r.norm() < 1e-10 * b.norm());
+}
@@ -1,6 +1,7 @@
 #include "catch2/catch.hpp"
 #include "test_common.h"
 #include "svd/dsvd.h"
+#include "svd/batch_polar.h"
 using namespace Test;
 
 // TEST_CASE("dsvd - dR/dF") {
@@ -108,4 +109,88 @@ TEST_CASE("dsvd2") {
   // finite_jacobian(vecF, E, fgrad, SECOND);
   // CHECK(compare_jacobian(J, fgrad));
   // std::cout << "!!!!!!!!!!!!!!" << std::endl;
-}
\ No newline at end of file
+}
+
+TEST_CASE("Batched polar - ds/dF") {
+  constexpr int W = BATCH_WIDTH;
+
+  // Polar decomposition of F, evaluated in every lane of a group
+  auto polar = [](const Matrix3d& F, Matrix3d& R, Vector6d& s,
+      Matrix<double,6,9>* dsdF) {
+    LaneMatrix<double,3,3> Fb, Rb;
+    LaneMatrix<double,6,1> sb;
+    LaneMatrix<double,6,9> Jb;
+    for (int l = 0; l < W; ++l) {
+      Fb.set(l, F);
+      Rb.set(l, Matrix3d::Identity());
+    }
+    batch_polar(Fb, Rb, sb, dsdF ? &Jb : nullptr, 1e-12);
+    R = Rb.get(W - 1);
+    s = sb.get(W - 1);
+    if (dsdF) *dsdF = Jb.get(W - 1);
+  };
+
+  Matrix3d F;
+  F << 1.0, 0.1, 0.2,
+       0.1, 2.0, 0.4,
+       0.3, 0.4, 0.5;
+
+  Matrix3d R;
+  Vector6d s;
+  Matrix<double,6,9> J;
+  polar(F, R, s, &J);
+
+  JacobiSVD<Matrix3d> svd(F, ComputeFullU | ComputeFullV);
+  Matrix3d U = svd.matrixU();
+  if ((U * svd.matrixV().transpose()).determinant() < 0) {
+    U.col(2) *= -1;
+  }
+  CHECK((R - U * svd.matrixV().transpose()).norm() < 1e-10);
+
+  auto E = [&](const VectorXd& vecF)-> VectorXd {
+    Matrix3d Rtmp;
+    Vector6d stmp;
+    polar(Matrix3d(vecF.data()), Rtmp, stmp, nullptr);
+    return stmp;
+  };
+
+  MatrixXd fgrad;
+  VectorXd vecF = Vector9d(F.data());
+  finite_jacobian(vecF, E, fgrad, SECOND);
+  CHECK(compare_jacobian(J, fgrad));
+}
+
+TEST_CASE("Batched polar 2D - ds/dF") {
+  constexpr int W = BATCH_WIDTH;
+
+  auto polar = [](const Matrix2d& F, Vector3d& s, Matrix<double,3,4>* dsdF) {
+    LaneMatrix<double,2,2> Fb, Rb;
+    LaneMatrix<double,3,1> sb;
+    LaneMatrix<double,3,4> Jb;
+    for (int l = 0; l < W; ++l) {
+      Fb.set(l, F);
+    }
+    batch_polar(Fb, Rb, sb, dsdF ? &Jb : nullptr);
+    s = sb.get(0);
+    if (dsdF) *dsdF = Jb.get(0);
+  };
+
+  Matrix2d F;
+  F << 1.0, 0.3,
+      -0.2, 0.7;
+
+  Vector3d s;
+  Matrix<double,3,4> J;
+  polar(F, s, &J);
+
+  auto E = [&](const VectorXd& vecF)-> VectorXd {
+    Vector3d stmp;
+    polar(Matrix2d(vecF.data()), stmp, nullptr);
+    return stmp;
+  };
+
+  MatrixXd fgrad;
+  VectorXd vecF = Vector4d(F.data());
+  finite_jacobian(vecF, E, fgrad, SECOND);
+  CHECK(compare_jacobian(J, fgrad));
+}
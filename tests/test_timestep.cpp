@@ -0,0 +1,184 @@
+#include "catch2/catch.hpp"
+#include "test_common.h"
+#include "config.h"
+#include "time_integrators/BDF.h"
+#include "time_integrators/timestep_controller.h"
+#include "linear_solvers/affine_pcg.h"
+#include <cmath>
+#include <functional>
+
+using namespace Eigen;
+using namespace mfem;
+
+namespace {
+
+  // BDF integrator whose history samples the trajectory x(t) (and its
+  // velocity v(t)) every h up to time t0
+  template <int I>
+  BDF<I> exact_history(const std::function<double(double)>& x,
+      const std::function<double(double)>& v, double t0, double h) {
+    BDF<I> bdf(VectorXd::Zero(1), VectorXd::Zero(1), h);
+    MatrixXd X(1, I + 1), V(1, I);
+    for (int j = 0; j <= I; ++j) {
+      X(0,j) = x(t0 - j*h);
+    }
+    for (int j = 0; j < I; ++j) {
+      V(0,j) = v(t0 - j*h);
+    }
+    Checkpoint ckpt;
+    ckpt.set("integrator/h", Matrix<double,1,1>(h));
+    ckpt.set("integrator/x_prevs", X);
+    ckpt.set("integrator/v_prevs", V);
+    REQUIRE(bdf.load_state(ckpt));
+    return bdf;
+  }
+
+  // One step of x'' = -x from the exact history at t0. Returns the error
+  // estimate and the actual local error of the step.
+  template <int I>
+  std::pair<double, double> oscillator_step(double h) {
+    double t0 = 0.3;
+    BDF<I> bdf = exact_history<I>([](double t) { return std::cos(t); },
+        [](double t) { return -std::sin(t); }, t0, h);
+
+    // Minimizer of 1/2 (x - x_tilde)^2 + dt^2 x^2 / 2
+    double dt = bdf.dt();
+    VectorXd x = bdf.x_tilde() / (1.0 + dt*dt);
+    return {bdf.error_estimate(x), std::abs(x(0) - std::cos(t0 + h))};
+  }
+
+  template <int I>
+  void check_error_estimate() {
+    auto [est, err] = oscillator_step<I>(5e-3);
+    auto [est_half, err_half] = oscillator_step<I>(2.5e-3);
+
+    // Milne's estimate is asymptotically exact
+    CHECK(est / err == Approx(1.0).epsilon(0.05));
+    CHECK(est_half / err_half == Approx(1.0).epsilon(0.05));
+
+    // and the local error is of order I+1
+    CHECK(est / est_half == Approx(std::pow(2.0, I + 1)).epsilon(0.05));
+  }
+}
+
+TEST_CASE("Adaptive timestep - error estimate") {
+  SECTION("BDF1") {
+    check_error_estimate<1>();
+  }
+  SECTION("BDF2") {
+    check_error_estimate<2>();
+  }
+  SECTION("BDF3") {
+    check_error_estimate<3>();
+  }
+}
+
+TEST_CASE("Adaptive timestep - rejected steps") {
+  // BDF2 resamples a quadratic trajectory exactly
+  auto x = [](double t) { return 1.0 + 2.0*t + 3.0*t*t; };
+  auto v = [](double t) { return 2.0 + 6.0*t; };
+  double h = 0.1;
+  BDF<2> bdf = exact_history<2>(x, v, 0.0, h);
+
+  std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+  config->h_min = 1e-4;
+  config->h_max = 1.0;
+  config->lte_tol = 1e-3;
+  TimestepController controller(config);
+
+  // The solve perturbs the variables, which the controller must restore
+  // before retrying
+  double state = 0;
+  int solves = 0;
+  int restores = 0;
+  auto restore = [&]() {
+    state = 0;
+    ++restores;
+  };
+
+  SECTION("Newton failure") {
+    auto solve = [&](VectorXd& xs) {
+      CHECK(state == 0);
+      state = 1;
+      xs = VectorXd::Constant(1, x(bdf.h()));
+      return ++solves > 1;
+    };
+    double h_accepted = controller.step(bdf, solve, restore);
+
+    // Failed steps are halved
+    CHECK(h_accepted == Approx(0.5 * h));
+    CHECK(controller.rejections() == 1);
+    CHECK(restores == 1);
+    CHECK(controller.error() == Approx(0.0).margin(1e-10));
+  }
+
+  SECTION("Error estimate above tolerance") {
+    auto solve = [&](VectorXd& xs) {
+      CHECK(state == 0);
+      state = 1;
+      // Far from the predictor on the first try
+      double offset = (++solves == 1) ? 1.0 : 0.0;
+      xs = VectorXd::Constant(1, x(bdf.h()) + offset);
+      return true;
+    };
+    double h_accepted = controller.step(bdf, solve, restore);
+
+    CHECK(h_accepted < h);
+    CHECK(h_accepted >= 0.2 * h - 1e-12);
+    CHECK(controller.rejections() == 1);
+    CHECK(restores == 1);
+  }
+
+  // The history is resampled at the accepted step size
+  double h_new = bdf.h();
+  Checkpoint ckpt;
+  bdf.save_state(ckpt);
+  MatrixXd X, V;
+  REQUIRE(ckpt.get("integrator/x_prevs", X));
+  REQUIRE(ckpt.get("integrator/v_prevs", V));
+  for (int j = 0; j < X.cols(); ++j) {
+    CHECK(X(0,j) == Approx(x(-j*h_new)));
+  }
+  for (int j = 0; j < V.cols(); ++j) {
+    CHECK(V(0,j) == Approx(v(-j*h_new)));
+  }
+}
+
+TEST_CASE("Adaptive timestep - AffinePCG preconditioner") {
+  MatrixXd V;
+  MatrixXi T, F;
+  igl::readMESH("../models/coarser_bunny.mesh", V, T, F);
+
+  std::shared_ptr<MaterialConfig> material_config =
+      std::make_shared<MaterialConfig>();
+  std::shared_ptr<MaterialModel> material =
+      std::make_shared<StableNeohookean>(material_config);
+  std::shared_ptr<Mesh> mesh = std::make_shared<TetrahedralMesh>(V, T,
+      material, material_config);
+  mesh->update_free_map();
+  mesh->init();
+
+  std::shared_ptr<SimConfig> config = std::make_shared<SimConfig>();
+  config->show_data = false;
+  config->h = 1e-4;
+  config->itr_tol = 1e-10;
+
+  // System the preconditioner of a larger step factorizes exactly
+  double h = 0.05;
+  SparseMatrixdRowMajor A = mesh->mass_matrix()
+      + (h * h * material_config->mu) * mesh->laplacian();
+  VectorXd b = VectorXd::Random(A.rows());
+
+  AffinePCG<double, RowMajor> stale(mesh, config);
+  stale.compute(A);
+  stale.solve(b);
+
+  AffinePCG<double, RowMajor> updated(mesh, config);
+  updated.set_timestep(h);
+  updated.compute(A);
+  VectorXd x = updated.solve(b);
+
+  CHECK((A * x - b).norm() < 1e-8 * b.norm());
+  CHECK(updated.iterations() <= 2);
+  CHECK(updated.iterations() < stale.iterations());
+}